@@ -0,0 +1,150 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "Event.hpp"
+#include "EventT.hpp"
+#include "IPort.hpp"
+
+// Publish/subscribe hub: every event sent to the bus is delivered to all
+// subscribers of its Event::getMessageId(), in subscription order, and to
+// the subscribers of all ids. Being an IPort itself, the bus can be given
+// to a producer in place of each of its ports.
+//
+// Routes are kept in one flat table, rebuilt on every (un)subscription:
+// the routes of id N are m_routes[m_offsets[N]] up to m_offsets[N + 1],
+// and the last slot holds the routes of ids nobody subscribed to. As with
+// EventDispatcher, message ids are expected to be small constants.
+//
+// A member function subscriber is called directly, with the payload and
+// without cloning the event. An IPort subscriber gets a clone.
+// Subscribing or unsubscribing from within a delivery is not supported.
+// The bus is not synchronized.
+class EventBus : public IPort
+{
+public:
+    using SubscriptionId = std::size_t;
+
+    EventBus()
+        : m_nextId(0),
+          m_offsets(2, 0)
+    {}
+
+    template <class T, class Subscriber, void (Subscriber::*Handler)(T const&)>
+    SubscriptionId subscribe(Subscriber& p_subscriber)
+    {
+        return add(T::MESSAGE_ID, false, Route{&invoke<T, Subscriber, Handler>, &p_subscriber});
+    }
+
+    SubscriptionId subscribe(std::uint32_t p_messageId, IPort& p_port)
+    {
+        return add(p_messageId, false, Route{&forward, &p_port});
+    }
+
+    SubscriptionId subscribeAll(IPort& p_port)
+    {
+        return add(0, true, Route{&forward, &p_port});
+    }
+
+    // Returns false for an id that is not subscribed.
+    bool unsubscribe(SubscriptionId p_id)
+    {
+        auto const l_found = std::find_if(m_subscriptions.begin(), m_subscriptions.end(),
+                                          [p_id](Subscription const& p_sub) { return p_sub.id == p_id; });
+        if (l_found == m_subscriptions.end()) {
+            return false;
+        }
+
+        m_subscriptions.erase(l_found);
+        rebuild();
+        return true;
+    }
+
+    // Returns the number of subscribers the event was delivered to.
+    std::size_t publish(Event const& p_evt) const
+    {
+        std::size_t const l_others = m_offsets.size() - 2;
+        std::uint32_t const l_id = p_evt.getMessageId();
+        std::size_t const l_slot = l_id < l_others ? l_id : l_others;
+
+        Route const* const l_begin = m_routes.data() + m_offsets[l_slot];
+        Route const* const l_end = m_routes.data() + m_offsets[l_slot + 1];
+        for (Route const* l_route = l_begin; l_route != l_end; ++l_route) {
+            l_route->deliver(l_route->subscriber, p_evt);
+        }
+        return static_cast<std::size_t>(l_end - l_begin);
+    }
+
+    void send(std::unique_ptr<Event> p_evt) override
+    {
+        publish(*p_evt);
+    }
+
+    std::size_t subscriptionCount() const { return m_subscriptions.size(); }
+
+private:
+    using Thunk = void (*)(void*, Event const&);
+
+    struct Route
+    {
+        Thunk deliver;
+        void* subscriber;
+    };
+
+    struct Subscription
+    {
+        SubscriptionId id;
+        std::uint32_t messageId;
+        bool allIds;
+        Route route;
+    };
+
+    template <class T, class Subscriber, void (Subscriber::*Handler)(T const&)>
+    static void invoke(void* p_subscriber, Event const& p_evt)
+    {
+        (static_cast<Subscriber*>(p_subscriber)->*Handler)(*eventCast<T>(p_evt));
+    }
+
+    static void forward(void* p_port, Event const& p_evt)
+    {
+        static_cast<IPort*>(p_port)->send(p_evt.clone());
+    }
+
+    SubscriptionId add(std::uint32_t p_messageId, bool p_allIds, Route p_route)
+    {
+        m_subscriptions.push_back(Subscription{m_nextId, p_messageId, p_allIds, p_route});
+        rebuild();
+        return m_nextId++;
+    }
+
+    void rebuild()
+    {
+        std::size_t l_others = 0;
+        for (auto const& l_sub : m_subscriptions) {
+            if (not l_sub.allIds) {
+                l_others = std::max<std::size_t>(l_others, std::size_t(l_sub.messageId) + 1);
+            }
+        }
+
+        m_routes.clear();
+        m_offsets.assign(l_others + 2, 0);
+        for (std::size_t l_slot = 0; l_slot <= l_others; ++l_slot) {
+            m_offsets[l_slot] = m_routes.size();
+            for (auto const& l_sub : m_subscriptions) {
+                if (l_sub.allIds or (l_slot < l_others and l_sub.messageId == l_slot)) {
+                    m_routes.push_back(l_sub.route);
+                }
+            }
+        }
+        m_offsets[l_others + 1] = m_routes.size();
+    }
+
+    SubscriptionId m_nextId;
+    std::vector<Subscription> m_subscriptions;
+    std::vector<std::size_t> m_offsets;
+    std::vector<Route> m_routes;
+};
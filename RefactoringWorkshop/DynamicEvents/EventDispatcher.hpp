@@ -0,0 +1,48 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "Event.hpp"
+#include "EventT.hpp"
+
+// Routes events to member functions of Owner by Event::getMessageId().
+// Lookup is a single index into a flat table, so message ids are expected
+// to be small constants (as the MESSAGE_ID values of a protocol are).
+// An id is assumed to identify exactly one payload type carried by EventT;
+// debug builds assert it, see eventCast().
+template <class Owner>
+class EventDispatcher
+{
+public:
+    template <class T, void (Owner::*Handler)(T const&)>
+    void registerHandler()
+    {
+        if (T::MESSAGE_ID >= m_handlers.size()) {
+            m_handlers.resize(T::MESSAGE_ID + 1, nullptr);
+        }
+        m_handlers[T::MESSAGE_ID] = &invoke<T, Handler>;
+    }
+
+    bool dispatch(Owner& p_owner, Event const& p_evt) const
+    {
+        auto const id = p_evt.getMessageId();
+        if (id >= m_handlers.size() or not m_handlers[id]) {
+            return false;
+        }
+
+        m_handlers[id](p_owner, p_evt);
+        return true;
+    }
+
+private:
+    using Thunk = void (*)(Owner&, Event const&);
+
+    template <class T, void (Owner::*Handler)(T const&)>
+    static void invoke(Owner& p_owner, Event const& p_evt)
+    {
+        (p_owner.*Handler)(*eventCast<T>(p_evt));
+    }
+
+    std::vector<Thunk> m_handlers;
+};
@@ -0,0 +1,162 @@
+#pragma once
+
+#include <cerrno>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <system_error>
+#include <vector>
+
+#include "Event.hpp"
+#include "IEventHandler.hpp"
+#include "IPort.hpp"
+#include "WireFormat.hpp"
+
+// A journal file is a JournalFileHeader followed by records. Each record is
+// a JournalRecordHeader and one wire record (see WireFormat.hpp), so every
+// record starts on a wireAlignment boundary.
+struct JournalFileHeader
+{
+    char magic[4];
+    std::uint32_t version;
+};
+
+struct JournalRecordHeader
+{
+    std::uint64_t timestamp; // steady clock, nanoseconds
+    std::uint32_t channel;
+    std::uint32_t reserved;
+};
+
+constexpr char journalMagic[4] = {'E', 'V', 'J', 'R'};
+constexpr std::uint32_t journalVersion = 1;
+
+// Events received by the recorded handler go to this channel; events it
+// sends out are recorded on channels chosen per port, starting from 1.
+constexpr std::uint32_t journalInputChannel = 0;
+
+// Appends records to a journal file. Records are collected in memory and
+// written out in blocks of about p_flushThreshold bytes and on destruction.
+template <class Codec>
+class JournalWriter
+{
+public:
+    explicit JournalWriter(std::string const& p_path, std::size_t p_flushThreshold = 1 << 16)
+        : m_file(std::fopen(p_path.c_str(), "wb")),
+          m_flushThreshold(p_flushThreshold)
+    {
+        if (not m_file) {
+            throw std::system_error(errno, std::generic_category(), "Cannot open journal " + p_path);
+        }
+
+        JournalFileHeader l_header;
+        std::memcpy(l_header.magic, journalMagic, sizeof(l_header.magic));
+        l_header.version = journalVersion;
+        append(&l_header, sizeof(l_header));
+    }
+
+    ~JournalWriter()
+    {
+        try {
+            flush();
+        } catch (std::system_error&) {
+        }
+        std::fclose(m_file);
+    }
+
+    JournalWriter(JournalWriter const&) = delete;
+    JournalWriter& operator=(JournalWriter const&) = delete;
+
+    void record(std::uint32_t p_channel, Event const& p_evt)
+    {
+        JournalRecordHeader l_header;
+        l_header.timestamp = static_cast<std::uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now().time_since_epoch()).count());
+        l_header.channel = p_channel;
+        l_header.reserved = 0;
+
+        append(&l_header, sizeof(l_header));
+        Codec::encode(p_evt, m_buffer);
+
+        if (m_buffer.size() >= m_flushThreshold) {
+            flush();
+        }
+    }
+
+    void flush()
+    {
+        if (not m_buffer.empty()) {
+            if (std::fwrite(m_buffer.data(), 1, m_buffer.size(), m_file) != m_buffer.size() or std::fflush(m_file)) {
+                throw std::system_error(errno, std::generic_category(), "Cannot write journal");
+            }
+            m_buffer.clear();
+        }
+    }
+
+private:
+    void append(void const* p_data, std::size_t p_size)
+    {
+        auto const* l_bytes = static_cast<unsigned char const*>(p_data);
+        m_buffer.insert(m_buffer.end(), l_bytes, l_bytes + p_size);
+    }
+
+    std::FILE* m_file;
+    std::size_t m_flushThreshold;
+    std::vector<unsigned char> m_buffer;
+};
+
+// Records every event on the journal's input channel, then hands it on.
+template <class Codec>
+class RecordingEventHandler : public IEventHandler
+{
+public:
+    RecordingEventHandler(JournalWriter<Codec>& p_journal, IEventHandler& p_target)
+        : m_journal(p_journal),
+          m_target(p_target)
+    {}
+
+    void receive(std::unique_ptr<Event> p_evt) override
+    {
+        m_journal.record(journalInputChannel, *p_evt);
+        m_target.receive(std::move(p_evt));
+    }
+
+private:
+    JournalWriter<Codec>& m_journal;
+    IEventHandler& m_target;
+};
+
+// Records every event sent through it on p_channel, then forwards it.
+template <class Codec>
+class RecordingPort : public IPort
+{
+public:
+    RecordingPort(JournalWriter<Codec>& p_journal, std::uint32_t p_channel, IPort& p_target)
+        : m_journal(p_journal),
+          m_channel(p_channel),
+          m_target(p_target)
+    {}
+
+    void send(std::unique_ptr<Event> p_evt) override
+    {
+        m_journal.record(m_channel, *p_evt);
+        m_target.send(std::move(p_evt));
+    }
+
+    void sendBatch(EventBatch p_events) override
+    {
+        for (auto const& l_evt : p_events) {
+            m_journal.record(m_channel, *l_evt);
+        }
+        m_target.sendBatch(p_events);
+    }
+
+private:
+    JournalWriter<Codec>& m_journal;
+    std::uint32_t m_channel;
+    IPort& m_target;
+};
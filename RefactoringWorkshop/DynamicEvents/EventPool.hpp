@@ -0,0 +1,141 @@
+#pragma once
+
+#include <cstddef>
+#include <new>
+
+// Counters of the calling thread, summed over all pooled event types.
+struct EventPoolStats
+{
+    std::size_t heapAllocations = 0; // blocks taken from the global heap
+    std::size_t reuses = 0;          // blocks served from a free list
+    std::size_t releases = 0;        // blocks returned to a free list
+    std::size_t heapReleases = 0;    // blocks given back to the global heap
+};
+
+namespace detail
+{
+
+inline EventPoolStats& eventPoolStats()
+{
+    thread_local EventPoolStats s_stats;
+    return s_stats;
+}
+
+} // namespace detail
+
+inline EventPoolStats eventPoolStats()
+{
+    return detail::eventPoolStats();
+}
+
+inline void resetEventPoolStats()
+{
+    detail::eventPoolStats() = EventPoolStats();
+}
+
+// Per-thread free list of blocks sized for T. EventT routes its class
+// operator new/delete here, so every std::make_unique<EventT<X>> and every
+// std::unique_ptr<Event> destruction goes through the pool of its message
+// type without changing the IPort/IEventHandler signatures.
+//
+// A block freed on another thread than the one that allocated it lands in
+// the freeing thread's list; each list is capped at maxCached blocks so
+// one-way producer/consumer flows cannot grow it without bound.
+template <class T>
+class EventPool
+{
+public:
+    static constexpr std::size_t maxCached = 4096;
+
+    static void* allocate(std::size_t p_size)
+    {
+        auto& l_stats = detail::eventPoolStats();
+        auto& l_list = freeList();
+
+        if (p_size == sizeof(T) and l_list.head) {
+            Block* l_block = l_list.head;
+            l_list.head = l_block->next;
+            --l_list.size;
+            ++l_stats.reuses;
+            return l_block;
+        }
+
+        ++l_stats.heapAllocations;
+        return ::operator new(p_size == sizeof(T) ? sizeof(Block) : p_size);
+    }
+
+    static void deallocate(void* p_ptr, std::size_t p_size) noexcept
+    {
+        auto& l_stats = detail::eventPoolStats();
+        auto& l_list = freeList();
+
+        if (p_size == sizeof(T) and not l_list.closed and l_list.size < maxCached) {
+            Block* l_block = static_cast<Block*>(p_ptr);
+            l_block->next = l_list.head;
+            l_list.head = l_block;
+            ++l_list.size;
+            ++l_stats.releases;
+            return;
+        }
+
+        ++l_stats.heapReleases;
+        ::operator delete(p_ptr);
+    }
+
+    // Pre-fills the calling thread's free list so the first ticks do not
+    // hit the heap either.
+    static void reserve(std::size_t p_count)
+    {
+        while (cached() < p_count and cached() < maxCached) {
+            ++detail::eventPoolStats().heapAllocations;
+            deallocate(::operator new(sizeof(Block)), sizeof(T));
+        }
+    }
+
+    // Gives every cached block of the calling thread back to the heap.
+    static void trim() noexcept
+    {
+        auto& l_list = freeList();
+        while (l_list.head) {
+            Block* l_block = l_list.head;
+            l_list.head = l_block->next;
+            ::operator delete(l_block);
+        }
+        l_list.size = 0;
+    }
+
+    static std::size_t cached() noexcept { return freeList().size; }
+
+private:
+    union Block
+    {
+        Block* next;
+        alignas(T) unsigned char storage[sizeof(T)];
+    };
+
+    // Kept trivially destructible so that events destroyed during thread
+    // teardown can still see that the list is closed.
+    struct FreeList
+    {
+        Block* head;
+        std::size_t size;
+        bool closed;
+    };
+
+    struct Reaper
+    {
+        ~Reaper()
+        {
+            trim();
+            freeList().closed = true;
+        }
+    };
+
+    static FreeList& freeList() noexcept
+    {
+        thread_local FreeList s_list = {nullptr, 0, false};
+        thread_local Reaper s_reaper;
+        (void)s_reaper;
+        return s_list;
+    }
+};
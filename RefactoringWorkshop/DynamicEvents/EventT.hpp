@@ -1,41 +1,212 @@
 #pragma once
 
+#include <atomic>
+#include <cassert>
+#include <cstddef>
 #include <memory>
+#include <new>
 #include <type_traits>
 
 #include "Event.hpp"
+#include "EventPool.hpp"
+
+// Selects the EventT constructor that refers to a payload living elsewhere,
+// e.g. in a receive buffer, instead of copying it. The payload must outlive
+// the event; clone() of such an event makes an owning copy.
+struct BorrowPayload {};
+constexpr BorrowPayload borrowPayload{};
+
+namespace detail
+{
+
+// Selects the PayloadStorage constructor used by clone().
+struct SharePayload {};
+
+// Heap block holding a payload shared by the clones of an event.
+template <class T>
+struct SharedPayload
+{
+    template <class U>
+    explicit SharedPayload(U&& p_payload)
+        : refs(1),
+          value(std::forward<U>(p_payload))
+    {}
+
+    static void* operator new(std::size_t p_size) { return EventPool<SharedPayload>::allocate(p_size); }
+    static void operator delete(void* p_ptr, std::size_t p_size) noexcept { EventPool<SharedPayload>::deallocate(p_ptr, p_size); }
+
+    std::atomic<std::size_t> refs;
+    T value;
+};
+
+// Trivially-copyable payloads are kept inside the event object itself,
+// so creating an event costs exactly one allocation (the event). They can
+// also be borrowed from outside. Other payloads live in a pooled,
+// reference counted block that clones share: cloning only bumps the
+// count, and the first non-const access through a clone whose block is
+// shared copies it. Once an event has given non-const access, its block
+// is never shared again, since the caller may still write through the
+// reference: its clones get copies of their own.
+template <class T, bool Inline = std::is_trivially_copyable<T>::value>
+class PayloadStorage
+{
+public:
+    static constexpr bool isInline = false;
+
+    explicit PayloadStorage(T const& p_payload)
+        : m_block(new SharedPayload<T>(p_payload)),
+          m_exposed(false)
+    {}
+
+    explicit PayloadStorage(T&& p_payload)
+        : m_block(new SharedPayload<T>(std::move(p_payload))),
+          m_exposed(false)
+    {}
+
+    PayloadStorage(SharePayload, PayloadStorage const& p_rhs)
+        : m_block(p_rhs.m_exposed ? new SharedPayload<T>(p_rhs.m_block->value) : p_rhs.m_block),
+          m_exposed(false)
+    {
+        if (not p_rhs.m_exposed) {
+            m_block->refs.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    PayloadStorage(PayloadStorage&& p_rhs) noexcept
+        : m_block(p_rhs.m_block),
+          m_exposed(p_rhs.m_exposed)
+    {
+        p_rhs.m_block = nullptr;
+    }
+
+    ~PayloadStorage() { release(); }
+
+    PayloadStorage& operator=(PayloadStorage const&) = delete;
+
+    T* get()
+    {
+        if (m_block->refs.load(std::memory_order_acquire) != 1) {
+            SharedPayload<T>* l_copy = new SharedPayload<T>(m_block->value);
+            release();
+            m_block = l_copy;
+        }
+        m_exposed = true;
+        return &m_block->value;
+    }
+
+    T const* get() const noexcept { return &m_block->value; }
+
+private:
+    void release() noexcept
+    {
+        if (m_block and m_block->refs.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            delete m_block;
+        }
+    }
+
+    SharedPayload<T>* m_block;
+    bool m_exposed; // non-const access was given, so clones copy
+};
+
+template <class T>
+class PayloadStorage<T, true>
+{
+public:
+    static constexpr bool isInline = true;
+
+    explicit PayloadStorage(T const& p_payload)
+        : m_payload(new (&m_storage) T(p_payload))
+    {}
+
+    PayloadStorage(BorrowPayload, T& p_payload)
+        : m_payload(&p_payload)
+    {}
+
+    PayloadStorage(SharePayload, PayloadStorage const& p_rhs)
+        : PayloadStorage(*p_rhs.m_payload)
+    {}
+
+    PayloadStorage(PayloadStorage&& p_rhs) noexcept
+        : m_payload(p_rhs.isBorrowed() ? p_rhs.m_payload : new (&m_storage) T(*p_rhs.m_payload))
+    {}
+
+    bool isBorrowed() const noexcept { return m_payload != reinterpret_cast<T const*>(&m_storage); }
+
+    T* get() noexcept { return m_payload; }
+    T const* get() const noexcept { return m_payload; }
+
+private:
+    typename std::aligned_storage<sizeof(T), alignof(T)>::type m_storage;
+    T* m_payload;
+};
+
+template <class T, bool Inline>
+constexpr bool PayloadStorage<T, Inline>::isInline;
+
+template <class T>
+constexpr bool PayloadStorage<T, true>::isInline;
+
+} // namespace detail
 
 template <class T>
 class EventT : public Event
 {
     static_assert(std::is_copy_constructible<T>::value, "Payload type must be copy-construcible!");
 public:
+    static constexpr bool isPayloadInline = detail::PayloadStorage<T>::isInline;
+
     EventT(T const& payload = T())
-        : m_payload(std::make_unique<T>(payload))
+        : m_payload(payload)
     {}
 
     EventT(T&& payload)
-        : m_payload(std::make_unique<T>(std::forward<T>(payload)))
+        : m_payload(std::forward<T>(payload))
+    {}
+
+    EventT(BorrowPayload, T& payload)
+        : m_payload(borrowPayload, payload)
     {}
 
     EventT(EventT&&) = default;
 
+    static void* operator new(std::size_t p_size) { return EventPool<EventT<T>>::allocate(p_size); }
+    static void operator delete(void* p_ptr, std::size_t p_size) noexcept { EventPool<EventT<T>>::deallocate(p_ptr, p_size); }
+
     EventT(EventT<T> const&) = delete;
     EventT& operator=(EventT<T> const&) = delete;
 
     std::uint32_t getMessageId() const override { return T::MESSAGE_ID; };
-    std::unique_ptr<Event> clone() const { return std::make_unique<EventT<T>>(*m_payload); }
+    std::unique_ptr<Event> clone() const { return std::unique_ptr<Event>(new EventT<T>(detail::SharePayload{}, m_payload)); }
 
-    T * const operator->() noexcept { return m_payload.get(); }
+    // Non-const access copies a payload shared with clones first, and
+    // makes later clones copy it; see detail::PayloadStorage.
+    T * const operator->() { return m_payload.get(); }
     T const * const operator->() const noexcept { return m_payload.get(); }
 
-    T& operator*() noexcept { return *m_payload; }
-    T const& operator*() const noexcept { return *m_payload; }
+    T& operator*() { return *m_payload.get(); }
+    T const& operator*() const noexcept { return *m_payload.get(); }
 
 private:
-    std::unique_ptr<T> m_payload;
+    EventT(detail::SharePayload, detail::PayloadStorage<T> const& p_payload)
+        : m_payload(detail::SharePayload{}, p_payload)
+    {}
+
+    detail::PayloadStorage<T> m_payload;
 };
 
+template <class T>
+constexpr bool EventT<T>::isPayloadInline;
+
+// For callers that already know p_evt is an EventT<T>, e.g. from its
+// message id: no run-time check in release builds. Debug builds assert
+// it, catching an Event of another class with a clashing message id.
+template <class T>
+EventT<T> const& eventCast(Event const& p_evt)
+{
+    assert(dynamic_cast<EventT<T> const*>(&p_evt) and "message id does not match the event's class");
+    return static_cast<EventT<T> const&>(p_evt);
+}
+
 template <class T>
 T const& payload(Event const& p_evt)
 {
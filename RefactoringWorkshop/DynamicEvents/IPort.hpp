@@ -1,12 +1,31 @@
 #pragma once
 
+#include <cstddef>
 #include <memory>
 
 class Event;
 
+// Contiguous run of events handed to a port in a single call. The port
+// takes ownership of every element; the caller's slots are left empty.
+struct EventBatch
+{
+    std::unique_ptr<Event>* data;
+    std::size_t size;
+
+    std::unique_ptr<Event>* begin() const { return data; }
+    std::unique_ptr<Event>* end() const { return data + size; }
+};
+
 class IPort
 {
 public:
     virtual ~IPort() = default;
     virtual void send(std::unique_ptr<Event>) = 0;
+
+    virtual void sendBatch(EventBatch p_events)
+    {
+        for (auto& l_evt : p_events) {
+            send(std::move(l_evt));
+        }
+    }
 };
@@ -0,0 +1,209 @@
+#pragma once
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <system_error>
+#include <vector>
+
+#include "Event.hpp"
+#include "EventJournal.hpp"
+#include "IEventHandler.hpp"
+#include "IPort.hpp"
+#include "WireFormat.hpp"
+
+struct ReplayStats
+{
+    std::uint64_t inputs = 0;     // events fed to the handler
+    std::uint64_t outputs = 0;    // events the handler sent through port()
+    std::uint64_t mismatches = 0; // outputs that differ from, are missing
+                                  // from or were never in the journal
+};
+
+// Memory-maps a journal written by JournalWriter and feeds its input
+// channel to an IEventHandler as fast as it can. Input events are wire
+// views into the mapping (privately mapped, so the file is never
+// changed), so nothing is copied or allocated per event beyond the pooled
+// event object.
+//
+// With verification on, the handler's output ports must be the ones
+// returned by port(): every event sent through them is compared with the
+// next recorded output, byte for byte on the wire.
+template <class Codec>
+class JournalReplayer
+{
+public:
+    explicit JournalReplayer(std::string const& p_path)
+        : m_data(nullptr),
+          m_size(0),
+          m_cursor(0),
+          m_verify(false)
+    {
+        int const l_fd = ::open(p_path.c_str(), O_RDONLY);
+        if (l_fd < 0) {
+            throw std::system_error(errno, std::generic_category(), "Cannot open journal " + p_path);
+        }
+
+        struct stat l_stat;
+        if (::fstat(l_fd, &l_stat) == 0 and l_stat.st_size > 0) {
+            m_size = static_cast<std::size_t>(l_stat.st_size);
+            void* l_mapping = ::mmap(nullptr, m_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, l_fd, 0);
+            if (l_mapping != MAP_FAILED) {
+                m_data = static_cast<unsigned char*>(l_mapping);
+            }
+        }
+        int const l_error = errno;
+        ::close(l_fd);
+
+        if (not m_data) {
+            throw std::system_error(l_error, std::generic_category(), "Cannot map journal " + p_path);
+        }
+
+        if (not hasJournalHeader()) {
+            ::munmap(m_data, m_size);
+            throw WireFormatError("Not an event journal.");
+        }
+    }
+
+    ~JournalReplayer()
+    {
+        ::munmap(m_data, m_size);
+    }
+
+    JournalReplayer(JournalReplayer const&) = delete;
+    JournalReplayer& operator=(JournalReplayer const&) = delete;
+
+    // Port standing in for the recorded port of p_channel.
+    IPort& port(std::uint32_t p_channel)
+    {
+        while (m_ports.size() <= p_channel) {
+            m_ports.push_back(std::make_unique<VerifyingPort>(*this, static_cast<std::uint32_t>(m_ports.size())));
+        }
+        return *m_ports[p_channel];
+    }
+
+    ReplayStats replay(IEventHandler& p_handler, bool p_verify = true)
+    {
+        m_stats = ReplayStats();
+        m_verify = p_verify;
+        m_cursor = sizeof(JournalFileHeader);
+
+        while (m_cursor < m_size) {
+            if (channelAt(m_cursor) != journalInputChannel) {
+                // Recorded output the previous input did not reproduce.
+                if (m_verify) {
+                    ++m_stats.mismatches;
+                }
+                m_cursor += recordSizeAt(m_cursor);
+                continue;
+            }
+
+            std::size_t const l_wireOffset = m_cursor + sizeof(JournalRecordHeader);
+            std::size_t l_consumed;
+            auto l_evt = Codec::decode(m_data + l_wireOffset, m_size - l_wireOffset, l_consumed);
+            if (not l_evt) {
+                throw WireFormatError("Truncated journal record.");
+            }
+            m_cursor = l_wireOffset + l_consumed;
+
+            ++m_stats.inputs;
+            p_handler.receive(std::move(l_evt));
+        }
+        return m_stats;
+    }
+
+private:
+    class VerifyingPort : public IPort
+    {
+    public:
+        VerifyingPort(JournalReplayer& p_replayer, std::uint32_t p_channel)
+            : m_replayer(p_replayer),
+              m_channel(p_channel)
+        {}
+
+        void send(std::unique_ptr<Event> p_evt) override
+        {
+            m_replayer.verify(m_channel, *p_evt);
+        }
+
+    private:
+        JournalReplayer& m_replayer;
+        std::uint32_t m_channel;
+    };
+
+    bool hasJournalHeader() const
+    {
+        JournalFileHeader l_header;
+        if (m_size < sizeof(l_header)) {
+            return false;
+        }
+
+        std::memcpy(&l_header, m_data, sizeof(l_header));
+        return std::memcmp(l_header.magic, journalMagic, sizeof(l_header.magic)) == 0 and
+               l_header.version == journalVersion;
+    }
+
+    std::uint32_t channelAt(std::size_t p_offset) const
+    {
+        if (m_size - p_offset < sizeof(JournalRecordHeader) + sizeof(WireHeader)) {
+            throw WireFormatError("Truncated journal record.");
+        }
+
+        JournalRecordHeader l_header;
+        std::memcpy(&l_header, m_data + p_offset, sizeof(l_header));
+        return l_header.channel;
+    }
+
+    // Whole size of the record at p_offset; its header must be readable.
+    std::size_t recordSizeAt(std::size_t p_offset) const
+    {
+        WireHeader l_wire;
+        std::memcpy(&l_wire, m_data + p_offset + sizeof(JournalRecordHeader), sizeof(l_wire));
+
+        std::size_t const l_size = sizeof(JournalRecordHeader) + Codec::recordSize(l_wire.length);
+        if (m_size - p_offset < l_size) {
+            throw WireFormatError("Truncated journal record.");
+        }
+        return l_size;
+    }
+
+    void verify(std::uint32_t p_channel, Event const& p_evt)
+    {
+        ++m_stats.outputs;
+        if (not m_verify) {
+            return;
+        }
+
+        if (m_cursor >= m_size or channelAt(m_cursor) == journalInputChannel) {
+            // The journal has no output left for the current input.
+            ++m_stats.mismatches;
+            return;
+        }
+
+        std::size_t const l_recordSize = recordSizeAt(m_cursor);
+        std::size_t const l_wireSize = l_recordSize - sizeof(JournalRecordHeader);
+
+        m_scratch.clear();
+        Codec::encode(p_evt, m_scratch);
+        if (channelAt(m_cursor) != p_channel or m_scratch.size() != l_wireSize or
+            std::memcmp(m_scratch.data(), m_data + m_cursor + sizeof(JournalRecordHeader), l_wireSize)) {
+            ++m_stats.mismatches;
+        }
+        m_cursor += l_recordSize;
+    }
+
+    unsigned char* m_data;
+    std::size_t m_size;
+    std::size_t m_cursor;
+    bool m_verify;
+    ReplayStats m_stats;
+    std::vector<unsigned char> m_scratch;
+    std::vector<std::unique_ptr<VerifyingPort>> m_ports;
+};
@@ -0,0 +1,163 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <new>
+#include <thread>
+#include <type_traits>
+
+#include "Event.hpp"
+#include "IEventHandler.hpp"
+#include "IPort.hpp"
+
+// IPort that hands events over to another thread through a bounded
+// lock-free multi-producer single-consumer ring. Any number of threads may
+// send(); exactly one thread at a time may tryReceive()/drain()/run().
+//
+// Each slot carries a sequence number telling whose turn it is (the
+// bounded queue of D. Vyukov): producers claim a position with one CAS on
+// the tail, the consumer needs no read-modify-write at all.
+class QueuePort : public IPort
+{
+public:
+    // p_capacity is rounded up to a power of two.
+    explicit QueuePort(std::size_t p_capacity)
+        : m_mask(roundUp(p_capacity) - 1),
+          m_storage(new unsigned char[capacity() * sizeof(Cell) + c_cacheLine]),
+          m_cells(alignedCells(m_storage.get())),
+          m_tail(0),
+          m_head(0)
+    {
+        for (std::size_t i = 0; i < capacity(); ++i) {
+            new (&m_cells[i]) Cell;
+            m_cells[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    ~QueuePort()
+    {
+        while (tryReceive()) {}
+    }
+
+    QueuePort(QueuePort const&) = delete;
+    QueuePort& operator=(QueuePort const&) = delete;
+
+    // Blocks (yielding) while the ring is full.
+    void send(std::unique_ptr<Event> p_evt) override
+    {
+        while (not trySend(p_evt)) {
+            std::this_thread::yield();
+        }
+    }
+
+    // On a full ring returns false and leaves p_evt with the caller.
+    bool trySend(std::unique_ptr<Event>& p_evt)
+    {
+        std::size_t l_pos = m_tail.load(std::memory_order_relaxed);
+
+        while (true) {
+            Cell& l_cell = m_cells[l_pos & m_mask];
+            std::size_t const l_sequence = l_cell.sequence.load(std::memory_order_acquire);
+            auto const l_lag = static_cast<std::ptrdiff_t>(l_sequence - l_pos);
+
+            if (l_lag == 0) {
+                if (m_tail.compare_exchange_weak(l_pos, l_pos + 1, std::memory_order_relaxed)) {
+                    l_cell.evt = p_evt.release();
+                    l_cell.sequence.store(l_pos + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (l_lag < 0) {
+                return false;
+            } else {
+                l_pos = m_tail.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    // Consumer side. Returns nullptr when the ring is empty.
+    std::unique_ptr<Event> tryReceive()
+    {
+        Cell& l_cell = m_cells[m_head & m_mask];
+        if (l_cell.sequence.load(std::memory_order_acquire) != m_head + 1) {
+            return nullptr;
+        }
+
+        std::unique_ptr<Event> l_evt(l_cell.evt);
+        l_cell.sequence.store(m_head + capacity(), std::memory_order_release);
+        ++m_head;
+        return l_evt;
+    }
+
+    // Consumer side. Feeds up to p_max queued events to p_handler and
+    // returns how many were delivered.
+    std::size_t drain(IEventHandler& p_handler, std::size_t p_max = std::numeric_limits<std::size_t>::max())
+    {
+        std::size_t l_delivered = 0;
+        while (l_delivered < p_max) {
+            auto l_evt = tryReceive();
+            if (not l_evt) {
+                break;
+            }
+            p_handler.receive(std::move(l_evt));
+            ++l_delivered;
+        }
+        return l_delivered;
+    }
+
+    // Consumer side. Drains into p_handler until p_stop is set, spinning
+    // briefly and then yielding while the ring is empty. Events still
+    // queued when it returns stay in the ring.
+    void run(IEventHandler& p_handler, std::atomic<bool> const& p_stop)
+    {
+        unsigned l_idleRounds = 0;
+        while (not p_stop.load(std::memory_order_acquire)) {
+            if (drain(p_handler)) {
+                l_idleRounds = 0;
+            } else if (++l_idleRounds > c_spinRounds) {
+                std::this_thread::yield();
+            }
+        }
+    }
+
+    std::size_t capacity() const { return m_mask + 1; }
+
+private:
+    static constexpr unsigned c_spinRounds = 64;
+    static constexpr std::size_t c_cacheLine = 64;
+
+    // One cell per cache line, so that producers and the consumer working
+    // on neighbouring cells do not falsely share. Before C++17 neither
+    // std::allocator nor new honour an alignment above that of
+    // std::max_align_t, so the cells are placed in a buffer by hand.
+    struct alignas(c_cacheLine) Cell
+    {
+        std::atomic<std::size_t> sequence;
+        Event* evt;
+    };
+    static_assert(sizeof(Cell) == c_cacheLine, "a Cell must fill exactly one cache line");
+    static_assert(std::is_trivially_destructible<Cell>::value, "cells are never destroyed");
+
+    static Cell* alignedCells(unsigned char* p_storage)
+    {
+        auto const l_address = reinterpret_cast<std::uintptr_t>(p_storage);
+        return reinterpret_cast<Cell*>((l_address + c_cacheLine - 1) & ~std::uintptr_t(c_cacheLine - 1));
+    }
+
+    static std::size_t roundUp(std::size_t p_capacity)
+    {
+        std::size_t l_size = 2;
+        while (l_size < p_capacity) {
+            l_size *= 2;
+        }
+        return l_size;
+    }
+
+    std::size_t const m_mask;
+    std::unique_ptr<unsigned char[]> m_storage;
+    Cell* const m_cells;
+    alignas(c_cacheLine) std::atomic<std::size_t> m_tail;
+    alignas(c_cacheLine) std::size_t m_head;
+};
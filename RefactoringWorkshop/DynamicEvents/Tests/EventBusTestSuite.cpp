@@ -0,0 +1,101 @@
+#include "EventBus.hpp"
+
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using namespace ::testing;
+
+namespace
+{
+
+struct PingPayload
+{
+    static constexpr std::uint32_t MESSAGE_ID = 0x21;
+
+    int sequence;
+};
+
+struct NamePayload
+{
+    static constexpr std::uint32_t MESSAGE_ID = 0x04;
+
+    std::string name;
+};
+
+struct Recorder
+{
+    void onPing(PingPayload const& p_ping) { log.push_back(tag + " ping " + std::to_string(p_ping.sequence)); }
+    void onName(NamePayload const& p_name) { log.push_back(tag + " name " + p_name.name); }
+
+    std::string tag;
+    std::vector<std::string>& log;
+};
+
+struct RecordingPort : IPort
+{
+    void send(std::unique_ptr<Event> p_evt) override { events.push_back(std::move(p_evt)); }
+
+    std::vector<std::unique_ptr<Event>> events;
+};
+
+} // namespace
+
+struct EventBusTest : Test
+{
+    EventBus sut;
+    std::vector<std::string> log;
+    Recorder first{"first", log};
+    Recorder second{"second", log};
+};
+
+TEST_F(EventBusTest, test_DeliversByMessageIdInSubscriptionOrder)
+{
+    sut.subscribe<PingPayload, Recorder, &Recorder::onPing>(second);
+    sut.subscribe<NamePayload, Recorder, &Recorder::onName>(first);
+    sut.subscribe<PingPayload, Recorder, &Recorder::onPing>(first);
+
+    EXPECT_EQ(2u, sut.publish(EventT<PingPayload>(PingPayload{1})));
+    sut.send(std::make_unique<EventT<NamePayload>>(NamePayload{"snake"}));
+
+    EXPECT_EQ((std::vector<std::string>{"second ping 1", "first ping 1", "first name snake"}), log);
+}
+
+TEST_F(EventBusTest, test_EventWithoutSubscribers_IsDropped)
+{
+    sut.subscribe<NamePayload, Recorder, &Recorder::onName>(first);
+
+    EXPECT_EQ(0u, sut.publish(EventT<PingPayload>(PingPayload{1})));
+    EXPECT_TRUE(log.empty());
+}
+
+TEST_F(EventBusTest, test_PortSubscribers_GetClones)
+{
+    RecordingPort l_pings, l_everything;
+    sut.subscribe(PingPayload::MESSAGE_ID, l_pings);
+    sut.subscribeAll(l_everything);
+
+    EventT<PingPayload> const l_ping(PingPayload{7});
+    sut.publish(l_ping);
+    sut.publish(EventT<NamePayload>(NamePayload{"snake"}));
+
+    ASSERT_EQ(1u, l_pings.events.size());
+    EXPECT_EQ(7, payload<PingPayload>(*l_pings.events[0]).sequence);
+    EXPECT_NE(&l_ping, l_pings.events[0].get());
+    ASSERT_EQ(2u, l_everything.events.size());
+    EXPECT_EQ("snake", payload<NamePayload>(*l_everything.events[1]).name);
+}
+
+TEST_F(EventBusTest, test_Unsubscribe_StopsDelivery)
+{
+    auto const l_id = sut.subscribe<PingPayload, Recorder, &Recorder::onPing>(first);
+    sut.subscribe<PingPayload, Recorder, &Recorder::onPing>(second);
+
+    EXPECT_TRUE(sut.unsubscribe(l_id));
+    EXPECT_FALSE(sut.unsubscribe(l_id));
+    sut.publish(EventT<PingPayload>(PingPayload{2}));
+
+    EXPECT_EQ(1u, sut.subscriptionCount());
+    EXPECT_EQ(std::vector<std::string>{"second ping 2"}, log);
+}
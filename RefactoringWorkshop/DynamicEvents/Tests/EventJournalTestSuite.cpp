@@ -0,0 +1,147 @@
+#include "EventJournal.hpp"
+#include "JournalReplayer.hpp"
+
+#include <cstdio>
+#include <string>
+
+#include <gtest/gtest.h>
+
+using namespace ::testing;
+
+namespace
+{
+
+struct CounterPayload
+{
+    static constexpr std::uint32_t MESSAGE_ID = 0x41;
+
+    int value;
+};
+
+struct ResetPayload
+{
+    static constexpr std::uint32_t MESSAGE_ID = 0x42;
+};
+
+using Codec = WireCodec<CounterPayload, ResetPayload>;
+
+struct NullPort : IPort
+{
+    void send(std::unique_ptr<Event>) override {}
+};
+
+// Adds every CounterPayload to a running sum and reports the sum on its
+// port; ResetPayload brings the sum back to p_start.
+class Accumulator : public IEventHandler
+{
+public:
+    Accumulator(IPort& p_port, int p_start)
+        : m_port(p_port),
+          m_start(p_start),
+          m_sum(p_start)
+    {}
+
+    void receive(std::unique_ptr<Event> p_evt) override
+    {
+        if (p_evt->getMessageId() == ResetPayload::MESSAGE_ID) {
+            m_sum = m_start;
+            return;
+        }
+        m_sum += payload<CounterPayload>(*p_evt).value;
+        m_port.send(std::make_unique<EventT<CounterPayload>>(CounterPayload{m_sum}));
+    }
+
+private:
+    IPort& m_port;
+    int m_start;
+    int m_sum;
+};
+
+} // namespace
+
+struct EventJournalTest : Test
+{
+    std::string path = TempDir() + "EventJournalTest.journal";
+
+    ~EventJournalTest()
+    {
+        std::remove(path.c_str());
+    }
+
+    void recordSession(int p_start)
+    {
+        JournalWriter<Codec> l_journal(path, 32);
+        NullPort l_sink;
+        RecordingPort<Codec> l_port(l_journal, 1, l_sink);
+        Accumulator l_accumulator(l_port, p_start);
+        RecordingEventHandler<Codec> l_handler(l_journal, l_accumulator);
+
+        l_handler.receive(std::make_unique<EventT<CounterPayload>>(CounterPayload{1}));
+        l_handler.receive(std::make_unique<EventT<CounterPayload>>(CounterPayload{2}));
+        l_handler.receive(std::make_unique<EventT<ResetPayload>>());
+        l_handler.receive(std::make_unique<EventT<CounterPayload>>(CounterPayload{3}));
+    }
+};
+
+TEST_F(EventJournalTest, test_ReplayOfSameHandler_ReproducesEveryOutput)
+{
+    recordSession(0);
+
+    JournalReplayer<Codec> l_replayer(path);
+    Accumulator l_accumulator(l_replayer.port(1), 0);
+    auto const l_stats = l_replayer.replay(l_accumulator);
+
+    EXPECT_EQ(4u, l_stats.inputs);
+    EXPECT_EQ(3u, l_stats.outputs);
+    EXPECT_EQ(0u, l_stats.mismatches);
+}
+
+TEST_F(EventJournalTest, test_ReplayOfDivergentHandler_CountsMismatches)
+{
+    recordSession(0);
+
+    JournalReplayer<Codec> l_replayer(path);
+    Accumulator l_accumulator(l_replayer.port(1), 10);
+    auto const l_stats = l_replayer.replay(l_accumulator);
+
+    EXPECT_EQ(3u, l_stats.outputs);
+    EXPECT_EQ(3u, l_stats.mismatches);
+}
+
+TEST_F(EventJournalTest, test_OutputOnWrongChannel_IsMismatch)
+{
+    recordSession(0);
+
+    JournalReplayer<Codec> l_replayer(path);
+    Accumulator l_accumulator(l_replayer.port(2), 0);
+    auto const l_stats = l_replayer.replay(l_accumulator);
+
+    EXPECT_EQ(3u, l_stats.mismatches);
+}
+
+TEST_F(EventJournalTest, test_ReplayWithoutVerification_CountsNoMismatches)
+{
+    recordSession(0);
+
+    JournalReplayer<Codec> l_replayer(path);
+    NullPort l_sink;
+    Accumulator l_accumulator(l_sink, 10);
+    auto const l_stats = l_replayer.replay(l_accumulator, false);
+
+    EXPECT_EQ(4u, l_stats.inputs);
+    EXPECT_EQ(0u, l_stats.mismatches);
+}
+
+TEST_F(EventJournalTest, test_FileWithoutJournalHeader_Throws)
+{
+    std::FILE* l_file = std::fopen(path.c_str(), "wb");
+    std::fputs("not a journal", l_file);
+    std::fclose(l_file);
+
+    EXPECT_THROW(JournalReplayer<Codec>{path}, WireFormatError);
+}
+
+TEST_F(EventJournalTest, test_MissingFile_Throws)
+{
+    EXPECT_THROW(JournalReplayer<Codec>{path}, std::system_error);
+}
@@ -0,0 +1,98 @@
+#include "EventPool.hpp"
+#include "EventT.hpp"
+
+#include <thread>
+
+#include <gtest/gtest.h>
+
+using namespace ::testing;
+
+namespace
+{
+
+struct PooledPayload
+{
+    static constexpr std::uint32_t MESSAGE_ID = 0x11;
+
+    int value;
+};
+
+struct OtherPooledPayload
+{
+    static constexpr std::uint32_t MESSAGE_ID = 0x12;
+
+    double value[4];
+};
+
+struct EventPoolTest : Test
+{
+    void SetUp() override
+    {
+        EventPool<EventT<PooledPayload>>::trim();
+        EventPool<EventT<OtherPooledPayload>>::trim();
+        resetEventPoolStats();
+    }
+};
+
+} // namespace
+
+TEST_F(EventPoolTest, test_FirstEvent_ComesFromHeap)
+{
+    auto l_evt = std::make_unique<EventT<PooledPayload>>();
+
+    EXPECT_EQ(1u, eventPoolStats().heapAllocations);
+    EXPECT_EQ(0u, eventPoolStats().reuses);
+}
+
+TEST_F(EventPoolTest, test_DestroyedEvent_IsReusedByNextOneOfSameType)
+{
+    auto* l_first = std::make_unique<EventT<PooledPayload>>().get();
+    auto l_second = std::make_unique<EventT<PooledPayload>>();
+
+    EXPECT_EQ(l_first, l_second.get());
+    EXPECT_EQ(1u, eventPoolStats().heapAllocations);
+    EXPECT_EQ(1u, eventPoolStats().releases);
+    EXPECT_EQ(1u, eventPoolStats().reuses);
+}
+
+TEST_F(EventPoolTest, test_TypesHaveSeparateFreeLists)
+{
+    std::make_unique<EventT<PooledPayload>>();
+    auto l_other = std::make_unique<EventT<OtherPooledPayload>>();
+
+    EXPECT_EQ(1u, EventPool<EventT<PooledPayload>>::cached());
+    EXPECT_EQ(2u, eventPoolStats().heapAllocations);
+}
+
+TEST_F(EventPoolTest, test_EventsReleasedThroughBasePointer_ReturnToPool)
+{
+    std::unique_ptr<Event> l_evt = std::make_unique<EventT<PooledPayload>>();
+    auto l_clone = l_evt->clone();
+    l_evt.reset();
+    l_clone.reset();
+
+    EXPECT_EQ(2u, EventPool<EventT<PooledPayload>>::cached());
+}
+
+TEST_F(EventPoolTest, test_Reserve_AvoidsHeapInSteadyState)
+{
+    EventPool<EventT<PooledPayload>>::reserve(8);
+    resetEventPoolStats();
+
+    for (int i = 0; i < 100; ++i) {
+        std::unique_ptr<Event> l_evt = std::make_unique<EventT<PooledPayload>>();
+    }
+
+    EXPECT_EQ(0u, eventPoolStats().heapAllocations);
+    EXPECT_EQ(100u, eventPoolStats().reuses);
+}
+
+TEST_F(EventPoolTest, test_EventFreedOnOtherThread_IsReleasedThere)
+{
+    std::unique_ptr<Event> l_evt = std::make_unique<EventT<PooledPayload>>();
+
+    std::thread([&l_evt] { l_evt.reset(); }).join();
+
+    EXPECT_EQ(0u, EventPool<EventT<PooledPayload>>::cached());
+    EXPECT_EQ(0u, eventPoolStats().releases);
+}
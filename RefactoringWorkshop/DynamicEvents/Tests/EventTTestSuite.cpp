@@ -0,0 +1,161 @@
+#include "EventT.hpp"
+
+#include <string>
+
+#include "EventDispatcher.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace ::testing;
+
+namespace
+{
+
+struct PodPayload
+{
+    static constexpr std::uint32_t MESSAGE_ID = 0x01;
+
+    int x;
+    int y;
+};
+
+struct EmptyPayload
+{
+    static constexpr std::uint32_t MESSAGE_ID = 0x02;
+};
+
+struct StringPayload
+{
+    static constexpr std::uint32_t MESSAGE_ID = 0x03;
+
+    std::string text;
+};
+
+// Not an EventT, yet claims the message id of PodPayload.
+struct ForeignEvent : Event
+{
+    std::uint32_t getMessageId() const override { return PodPayload::MESSAGE_ID; }
+    std::unique_ptr<Event> clone() const override { return std::make_unique<ForeignEvent>(); }
+};
+
+struct PodHandler
+{
+    void handle(PodPayload const& p_payload) { sum += p_payload.x + p_payload.y; }
+
+    int sum = 0;
+};
+
+} // namespace
+
+TEST(EventTTest, test_TriviallyCopyablePayloads_AreStoredInline)
+{
+    EXPECT_TRUE(EventT<PodPayload>::isPayloadInline);
+    EXPECT_TRUE(EventT<EmptyPayload>::isPayloadInline);
+    EXPECT_FALSE(EventT<StringPayload>::isPayloadInline);
+}
+
+TEST(EventTTest, test_InlinePayload_LivesInsideEventObject)
+{
+    EventT<PodPayload> l_evt;
+    auto const* l_begin = reinterpret_cast<char const*>(&l_evt);
+    auto const* l_payload = reinterpret_cast<char const*>(&*l_evt);
+
+    EXPECT_GE(l_payload, l_begin);
+    EXPECT_LT(l_payload, l_begin + sizeof(l_evt));
+}
+
+TEST(EventTTest, test_Clone_CopiesPayload)
+{
+    EventT<PodPayload> l_evt(PodPayload{3, 4});
+
+    auto l_clone = l_evt.clone();
+    l_evt->x = 5;
+
+    EXPECT_EQ(0x01u, l_clone->getMessageId());
+    EXPECT_EQ(3, payload<PodPayload>(*l_clone).x);
+    EXPECT_EQ(4, payload<PodPayload>(*l_clone).y);
+}
+
+TEST(EventTTest, test_HeapPayload_ClonesAndMoves)
+{
+    EventT<StringPayload> l_evt(StringPayload{"snake"});
+
+    auto l_clone = l_evt.clone();
+    EventT<StringPayload> l_moved(std::move(l_evt));
+
+    EXPECT_EQ("snake", payload<StringPayload>(*l_clone).text);
+    EXPECT_EQ("snake", l_moved->text);
+}
+
+TEST(EventTTest, test_HeapPayload_IsSharedByClones)
+{
+    EventT<StringPayload> const l_evt(StringPayload{"snake"});
+
+    auto const l_clone = l_evt.clone();
+    Event const& l_constClone = *l_clone;
+
+    EXPECT_EQ(&*l_evt, &payload<StringPayload>(l_constClone));
+}
+
+TEST(EventTTest, test_HeapPayload_IsCopiedOnWrite)
+{
+    EventT<StringPayload> l_evt(StringPayload{"snake"});
+    auto l_clone = l_evt.clone();
+
+    payload<StringPayload>(*l_clone).text = "viper";
+    l_evt->text += "s";
+
+    EXPECT_EQ("snakes", l_evt->text);
+    EXPECT_EQ("viper", payload<StringPayload>(*l_clone).text);
+}
+
+TEST(EventTTest, test_HeapPayload_WrittenThroughReferenceTakenBeforeClone_LeavesCloneAlone)
+{
+    EventT<StringPayload> l_evt(StringPayload{"snake"});
+    StringPayload& l_payload = *l_evt;
+
+    auto const l_clone = l_evt.clone();
+    l_payload.text = "viper";
+
+    EXPECT_EQ("viper", l_evt->text);
+    EXPECT_EQ("snake", payload<StringPayload>(static_cast<Event const&>(*l_clone)).text);
+}
+
+TEST(EventTTest, test_HeapPayload_LastOwnerWritesInPlace)
+{
+    EventT<StringPayload> l_evt(StringPayload{"snake"});
+    l_evt.clone().reset();
+
+    StringPayload const* l_before = &*static_cast<EventT<StringPayload> const&>(l_evt);
+    l_evt->text = "viper";
+
+    EXPECT_EQ(l_before, &*l_evt);
+}
+
+TEST(EventTTest, test_PayloadOfWrongType_ThrowsBadCast)
+{
+    EventT<PodPayload> l_evt;
+
+    EXPECT_THROW(payload<EmptyPayload>(l_evt), std::bad_cast);
+}
+
+TEST(EventCastTest, test_EventOfTheCastType_IsReturnedAsIs)
+{
+    EventT<PodPayload> const l_evt(PodPayload{3, 4});
+    Event const& l_base = l_evt;
+
+    EXPECT_EQ(&l_evt, &eventCast<PodPayload>(l_base));
+}
+
+#ifndef NDEBUG
+TEST(EventCastTest, test_ForeignEventWithClashingId_IsRejectedInDebugBuilds)
+{
+    ForeignEvent const l_evt;
+    EventDispatcher<PodHandler> l_dispatcher;
+    l_dispatcher.registerHandler<PodPayload, &PodHandler::handle>();
+    PodHandler l_handler;
+
+    EXPECT_DEATH(eventCast<PodPayload>(l_evt), "message id does not match");
+    EXPECT_DEATH(l_dispatcher.dispatch(l_handler, l_evt), "message id does not match");
+}
+#endif
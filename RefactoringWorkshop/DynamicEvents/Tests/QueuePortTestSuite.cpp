@@ -0,0 +1,150 @@
+#include "QueuePort.hpp"
+
+#include "EventT.hpp"
+
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using namespace ::testing;
+
+namespace
+{
+
+struct SequencedPayload
+{
+    static constexpr std::uint32_t MESSAGE_ID = 0x21;
+
+    int producer;
+    int sequence;
+};
+
+std::unique_ptr<Event> makeEvent(int p_producer, int p_sequence)
+{
+    return std::make_unique<EventT<SequencedPayload>>(SequencedPayload{p_producer, p_sequence});
+}
+
+struct RecordingHandler : IEventHandler
+{
+    void receive(std::unique_ptr<Event> p_evt) override
+    {
+        received.push_back(payload<SequencedPayload>(*p_evt));
+    }
+
+    std::vector<SequencedPayload> received;
+};
+
+struct CountingHandler : IEventHandler
+{
+    void receive(std::unique_ptr<Event>) override
+    {
+        received.fetch_add(1);
+    }
+
+    std::atomic<std::size_t> received{0};
+};
+
+} // namespace
+
+TEST(QueuePortTest, test_Capacity_IsRoundedUpToPowerOfTwo)
+{
+    EXPECT_EQ(8u, QueuePort(5).capacity());
+}
+
+TEST(QueuePortTest, test_EmptyQueue_ReceivesNothing)
+{
+    QueuePort l_sut(4);
+
+    EXPECT_EQ(nullptr, l_sut.tryReceive());
+}
+
+TEST(QueuePortTest, test_Events_AreDrainedInSendOrder)
+{
+    QueuePort l_sut(4);
+    RecordingHandler l_handler;
+
+    l_sut.send(makeEvent(0, 1));
+    l_sut.send(makeEvent(0, 2));
+    l_sut.send(makeEvent(0, 3));
+
+    EXPECT_EQ(3u, l_sut.drain(l_handler));
+    ASSERT_EQ(3u, l_handler.received.size());
+    EXPECT_EQ(1, l_handler.received[0].sequence);
+    EXPECT_EQ(3, l_handler.received[2].sequence);
+}
+
+TEST(QueuePortTest, test_TrySendOnFullQueue_KeepsEventWithCaller)
+{
+    QueuePort l_sut(2);
+    l_sut.send(makeEvent(0, 1));
+    l_sut.send(makeEvent(0, 2));
+
+    auto l_evt = makeEvent(0, 3);
+    EXPECT_FALSE(l_sut.trySend(l_evt));
+    ASSERT_NE(nullptr, l_evt);
+
+    l_sut.tryReceive();
+    EXPECT_TRUE(l_sut.trySend(l_evt));
+    EXPECT_EQ(nullptr, l_evt);
+}
+
+TEST(QueuePortTest, test_Drain_StopsAtLimit)
+{
+    QueuePort l_sut(8);
+    RecordingHandler l_handler;
+    for (int i = 0; i < 5; ++i) {
+        l_sut.send(makeEvent(0, i));
+    }
+
+    EXPECT_EQ(2u, l_sut.drain(l_handler, 2));
+    EXPECT_EQ(3u, l_sut.drain(l_handler));
+}
+
+TEST(QueuePortTest, test_ConcurrentProducers_DeliverEverythingInPerProducerOrder)
+{
+    constexpr int c_producers = 4;
+    constexpr int c_eventsPerProducer = 20000;
+    QueuePort l_sut(64);
+    RecordingHandler l_handler;
+
+    std::vector<std::thread> l_producers;
+    for (int p = 0; p < c_producers; ++p) {
+        l_producers.emplace_back([&l_sut, p] {
+            for (int i = 0; i < c_eventsPerProducer; ++i) {
+                l_sut.send(makeEvent(p, i));
+            }
+        });
+    }
+
+    while (l_handler.received.size() < std::size_t(c_producers * c_eventsPerProducer)) {
+        l_sut.drain(l_handler);
+    }
+    for (auto& l_producer : l_producers) {
+        l_producer.join();
+    }
+
+    std::vector<int> l_next(c_producers, 0);
+    for (auto const& l_evt : l_handler.received) {
+        EXPECT_EQ(l_next[l_evt.producer]++, l_evt.sequence);
+    }
+}
+
+TEST(QueuePortTest, test_Run_DrainsUntilStopped)
+{
+    QueuePort l_sut(8);
+    CountingHandler l_handler;
+    std::atomic<bool> l_stop(false);
+
+    std::thread l_consumer([&] { l_sut.run(l_handler, l_stop); });
+    for (int i = 0; i < 100; ++i) {
+        l_sut.send(makeEvent(0, i));
+    }
+    while (l_handler.received < 100u) {
+        std::this_thread::yield();
+    }
+    l_stop = true;
+    l_consumer.join();
+
+    EXPECT_EQ(100u, l_handler.received);
+}
@@ -0,0 +1,175 @@
+#include "TypedEvent.hpp"
+#include "TypedPort.hpp"
+
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using namespace ::testing;
+
+namespace
+{
+
+struct PingPayload
+{
+    static constexpr std::uint32_t MESSAGE_ID = 0x51;
+
+    int sequence;
+};
+
+struct NamePayload
+{
+    static constexpr std::uint32_t MESSAGE_ID = 0x52;
+
+    std::string name;
+};
+
+struct OtherPayload
+{
+    static constexpr std::uint32_t MESSAGE_ID = 0x53;
+};
+
+using TestEvent = TypedEvent<PingPayload, NamePayload>;
+
+// Counts live instances; copies throw while failCopies is set.
+struct FragilePayload
+{
+    static constexpr std::uint32_t MESSAGE_ID = 0x54;
+
+    FragilePayload() { ++live; }
+    FragilePayload(FragilePayload const&)
+    {
+        if (failCopies) {
+            throw std::runtime_error("copy failed");
+        }
+        ++live;
+    }
+    ~FragilePayload() { --live; }
+
+    static int live;
+    static bool failCopies;
+};
+
+int FragilePayload::live = 0;
+bool FragilePayload::failCopies = false;
+
+struct Describe
+{
+    std::string operator()(PingPayload const& p_ping) const { return "ping " + std::to_string(p_ping.sequence); }
+    std::string operator()(NamePayload const& p_name) const { return "name " + p_name.name; }
+};
+
+struct RecordingTypedPort : ITypedPort<PingPayload, NamePayload>
+{
+    void send(TestEvent const& p_evt) override { events.push_back(p_evt); }
+
+    std::vector<TestEvent> events;
+};
+
+struct RecordingPort : IPort
+{
+    void send(std::unique_ptr<Event> p_evt) override { events.push_back(std::move(p_evt)); }
+
+    std::vector<std::unique_ptr<Event>> events;
+};
+
+} // namespace
+
+TEST(TypedEventTest, test_HoldsThePayloadItWasBuiltFrom)
+{
+    TestEvent const l_evt = PingPayload{7};
+
+    EXPECT_TRUE(l_evt.holds<PingPayload>());
+    EXPECT_FALSE(l_evt.holds<NamePayload>());
+    EXPECT_EQ(7, l_evt.get<PingPayload>().sequence);
+    EXPECT_EQ(nullptr, l_evt.getIf<NamePayload>());
+    EXPECT_EQ(0x51u, l_evt.getMessageId());
+}
+
+TEST(TypedEventTest, test_GetOfOtherPayload_Throws)
+{
+    TestEvent const l_evt = PingPayload{7};
+
+    EXPECT_THROW(l_evt.get<NamePayload>(), TypedEventError);
+}
+
+TEST(TypedEventTest, test_Visit_CallsOverloadOfHeldPayload)
+{
+    EXPECT_EQ("ping 3", visit(Describe(), TestEvent(PingPayload{3})));
+    EXPECT_EQ("name snake", visit(Describe(), TestEvent(NamePayload{"snake"})));
+}
+
+TEST(TypedEventTest, test_CopiesOwnTheirPayload)
+{
+    TestEvent l_evt = NamePayload{"first"};
+    TestEvent l_copy = l_evt;
+    l_evt = PingPayload{1};
+
+    EXPECT_EQ("first", l_copy.get<NamePayload>().name);
+    l_copy = l_evt;
+    EXPECT_EQ(1, l_copy.get<PingPayload>().sequence);
+}
+
+TEST(TypedEventTest, test_AssignmentWhoseCopyThrows_LeavesTheEventValueless)
+{
+    {
+        TypedEvent<PingPayload, FragilePayload> l_evt = PingPayload{1};
+        TypedEvent<PingPayload, FragilePayload> const l_fragile = FragilePayload();
+        l_evt = l_fragile;
+        ASSERT_EQ(2, FragilePayload::live);
+
+        TypedEvent<PingPayload, FragilePayload> const l_other = FragilePayload();
+        FragilePayload::failCopies = true;
+        EXPECT_THROW(l_evt = l_other, std::runtime_error);
+        FragilePayload::failCopies = false;
+
+        EXPECT_TRUE(l_evt.valueless());
+        EXPECT_FALSE(l_evt.holds<FragilePayload>());
+        EXPECT_EQ(2, FragilePayload::live);
+
+        l_evt = PingPayload{2};
+        EXPECT_EQ(2, l_evt.get<PingPayload>().sequence);
+    }
+    EXPECT_EQ(0, FragilePayload::live);
+}
+
+TEST(TypedEventTest, test_ConvertsFromAndToEvent)
+{
+    auto const l_evt = TestEvent::from(EventT<NamePayload>(NamePayload{"snake"}));
+    auto const l_back = l_evt.toEvent();
+
+    EXPECT_EQ("snake", l_evt.get<NamePayload>().name);
+    ASSERT_EQ(0x52u, l_back->getMessageId());
+    EXPECT_EQ("snake", payload<NamePayload>(*l_back).name);
+}
+
+TEST(TypedEventTest, test_FromEventOutsidePayloads_Throws)
+{
+    EXPECT_THROW(TestEvent::from(EventT<OtherPayload>()), TypedEventError);
+}
+
+TEST(TypedPortTest, test_TypedPortAdapter_SendsEventsToIPort)
+{
+    RecordingPort l_target;
+    TypedPortAdapter<PingPayload, NamePayload> l_port(l_target);
+    TestEvent const l_events[] = {PingPayload{1}, NamePayload{"two"}};
+
+    l_port.sendBatch(l_events, 2);
+
+    ASSERT_EQ(2u, l_target.events.size());
+    EXPECT_EQ(1, payload<PingPayload>(*l_target.events[0]).sequence);
+    EXPECT_EQ("two", payload<NamePayload>(*l_target.events[1]).name);
+}
+
+TEST(TypedPortTest, test_EventPortAdapter_SendsTypedEvents)
+{
+    RecordingTypedPort l_target;
+    EventPortAdapter<PingPayload, NamePayload> l_port(l_target);
+
+    l_port.send(std::make_unique<EventT<PingPayload>>(PingPayload{5}));
+
+    ASSERT_EQ(1u, l_target.events.size());
+    EXPECT_EQ(5, l_target.events[0].get<PingPayload>().sequence);
+}
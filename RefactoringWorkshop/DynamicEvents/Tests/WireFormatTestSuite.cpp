@@ -0,0 +1,124 @@
+#include "WireFormat.hpp"
+
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using namespace ::testing;
+
+namespace
+{
+
+struct PointPayload
+{
+    static constexpr std::uint32_t MESSAGE_ID = 0x31;
+
+    int x;
+    int y;
+    int z;
+};
+
+struct TickPayload
+{
+    static constexpr std::uint32_t MESSAGE_ID = 0x32;
+};
+
+struct UnknownPayload
+{
+    static constexpr std::uint32_t MESSAGE_ID = 0x33;
+};
+
+using Codec = WireCodec<PointPayload, TickPayload>;
+
+struct RecordingHandler : IEventHandler
+{
+    void receive(std::unique_ptr<Event> p_evt) override
+    {
+        received.push_back(std::move(p_evt));
+    }
+
+    std::vector<std::unique_ptr<Event>> received;
+};
+
+struct WireFormatTest : Test
+{
+    std::vector<unsigned char> buffer;
+};
+
+} // namespace
+
+TEST_F(WireFormatTest, test_Record_IsHeaderAndPaddedPayload)
+{
+    Codec::encode(EventT<PointPayload>(PointPayload{1, 2, 3}), buffer);
+
+    ASSERT_EQ(sizeof(WireHeader) + 16, buffer.size());
+    WireHeader l_header;
+    std::memcpy(&l_header, buffer.data(), sizeof(l_header));
+    EXPECT_EQ(0x31u, l_header.messageId);
+    EXPECT_EQ(sizeof(PointPayload), l_header.length);
+}
+
+TEST_F(WireFormatTest, test_EmptyPayload_TakesNoPayloadBytes)
+{
+    Codec::encode(EventT<TickPayload>(), buffer);
+
+    EXPECT_EQ(sizeof(WireHeader), buffer.size());
+}
+
+TEST_F(WireFormatTest, test_EncodingUnknownMessage_Throws)
+{
+    EXPECT_THROW(Codec::encode(EventT<UnknownPayload>(), buffer), WireFormatError);
+}
+
+TEST_F(WireFormatTest, test_DecodedEvent_ViewsPayloadInBuffer)
+{
+    Codec::encode(EventT<PointPayload>(PointPayload{1, 2, 3}), buffer);
+
+    std::size_t l_consumed;
+    auto l_evt = Codec::decode(buffer.data(), buffer.size(), l_consumed);
+
+    ASSERT_NE(nullptr, l_evt);
+    EXPECT_EQ(buffer.size(), l_consumed);
+    auto const& l_payload = payload<PointPayload>(*l_evt);
+    EXPECT_EQ(static_cast<void const*>(buffer.data() + sizeof(WireHeader)), static_cast<void const*>(&l_payload));
+    EXPECT_EQ(3, l_payload.z);
+}
+
+TEST_F(WireFormatTest, test_CloneOfDecodedEvent_OwnsItsPayload)
+{
+    Codec::encode(EventT<PointPayload>(PointPayload{1, 2, 3}), buffer);
+    std::size_t l_consumed;
+    auto l_clone = Codec::decode(buffer.data(), buffer.size(), l_consumed)->clone();
+
+    std::fill(buffer.begin(), buffer.end(), 0);
+
+    EXPECT_EQ(2, payload<PointPayload>(*l_clone).y);
+}
+
+TEST_F(WireFormatTest, test_BatchDecode_DeliversWholeRecordsAndLeavesPartialOne)
+{
+    std::unique_ptr<Event> l_events[] = {
+        std::make_unique<EventT<PointPayload>>(PointPayload{1, 1, 1}),
+        std::make_unique<EventT<TickPayload>>(),
+        std::make_unique<EventT<PointPayload>>(PointPayload{2, 2, 2})};
+    Codec::encode(EventBatch{l_events, 3}, buffer);
+    std::size_t const l_lastRecord = Codec::recordSize(sizeof(PointPayload));
+
+    RecordingHandler l_handler;
+    auto l_consumed = Codec::decode(buffer.data(), buffer.size() - 1, l_handler);
+
+    EXPECT_EQ(buffer.size() - l_lastRecord, l_consumed);
+    ASSERT_EQ(2u, l_handler.received.size());
+    EXPECT_EQ(0x31u, l_handler.received[0]->getMessageId());
+    EXPECT_EQ(0x32u, l_handler.received[1]->getMessageId());
+}
+
+TEST_F(WireFormatTest, test_RecordWithWrongLength_Throws)
+{
+    WireHeader const l_header = {0x31, 4};
+    buffer.resize(Codec::recordSize(4));
+    std::memcpy(buffer.data(), &l_header, sizeof(l_header));
+
+    std::size_t l_consumed;
+    EXPECT_THROW(Codec::decode(buffer.data(), buffer.size(), l_consumed), WireFormatError);
+}
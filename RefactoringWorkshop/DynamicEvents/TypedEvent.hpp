@@ -0,0 +1,245 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "Event.hpp"
+#include "EventT.hpp"
+
+struct TypedEventError : std::logic_error
+{
+    explicit TypedEventError(char const* p_what)
+        : std::logic_error(p_what)
+    {}
+};
+
+namespace detail
+{
+
+// Position of T in Ts, sizeof...(Ts) when T is not there.
+template <class T, class... Ts>
+struct IndexOf : std::integral_constant<std::size_t, 0>
+{};
+
+template <class T, class... Ts>
+struct IndexOf<T, T, Ts...> : std::integral_constant<std::size_t, 0>
+{};
+
+template <class T, class U, class... Ts>
+struct IndexOf<T, U, Ts...> : std::integral_constant<std::size_t, 1 + IndexOf<T, Ts...>::value>
+{};
+
+template <bool...>
+struct BoolPack
+{};
+
+template <bool... Bs>
+using AllOf = std::is_same<BoolPack<Bs..., true>, BoolPack<true, Bs...>>;
+
+} // namespace detail
+
+// Event holding exactly one of a closed, compile-time set of payloads, by
+// value: no heap block, no vtable, and dispatch by visit() compiles into a
+// switch over the payload index instead of virtual calls and dynamic_cast.
+//
+// Each payload type needs a MESSAGE_ID, as for EventT; from() and toEvent()
+// convert from and to the Event hierarchy for code still using IPort and
+// IEventHandler.
+template <class... Payloads>
+class TypedEvent
+{
+    static_assert(sizeof...(Payloads) > 0, "TypedEvent needs at least one payload type!");
+    static_assert(sizeof...(Payloads) < 255, "Too many payload types for TypedEvent!");
+
+public:
+    template <class T>
+    static constexpr bool canHold()
+    {
+        return detail::IndexOf<std::decay_t<T>, Payloads...>::value < sizeof...(Payloads);
+    }
+
+    template <class T, class = std::enable_if_t<canHold<T>()>>
+    TypedEvent(T&& p_payload)
+        : m_index(indexOf<std::decay_t<T>>())
+    {
+        new (&m_storage) std::decay_t<T>(std::forward<T>(p_payload));
+    }
+
+    TypedEvent(TypedEvent const& p_rhs)
+        : m_index(p_rhs.m_index)
+    {
+        if (c_trivial) {
+            std::memcpy(&m_storage, &p_rhs.m_storage, sizeof(m_storage));
+        } else {
+            p_rhs.visit(CopyInto{&m_storage});
+        }
+    }
+
+    // Should copying the payload throw, the event is left valueless().
+    TypedEvent& operator=(TypedEvent const& p_rhs)
+    {
+        if (this != &p_rhs) {
+            destroy();
+            m_index = c_valueless;
+            p_rhs.visit(CopyInto{&m_storage});
+            m_index = p_rhs.m_index;
+        }
+        return *this;
+    }
+
+    ~TypedEvent()
+    {
+        destroy();
+    }
+
+    // Throws TypedEventError for an event none of Payloads belongs to.
+    static TypedEvent from(Event const& p_evt)
+    {
+        return fromAt(p_evt, Index<0>());
+    }
+
+    std::unique_ptr<Event> toEvent() const
+    {
+        return visit(ToEvent());
+    }
+
+    std::size_t index() const noexcept { return m_index; }
+
+    // Only after an assignment that threw. A valueless event holds no
+    // payload and may only be assigned to or destroyed.
+    bool valueless() const noexcept { return m_index == c_valueless; }
+
+    std::uint32_t getMessageId() const noexcept
+    {
+        static std::uint32_t const s_messageIds[] = {Payloads::MESSAGE_ID...};
+        return s_messageIds[m_index];
+    }
+
+    template <class T>
+    bool holds() const noexcept { return m_index == indexOf<T>(); }
+
+    // Throws TypedEventError when the event holds another payload type.
+    template <class T>
+    T const& get() const
+    {
+        if (not holds<T>()) {
+            throw TypedEventError("TypedEvent holds another payload type.");
+        }
+        return as<T>();
+    }
+
+    template <class T>
+    T const* getIf() const noexcept
+    {
+        return holds<T>() ? &as<T>() : nullptr;
+    }
+
+    // Calls p_visitor with the payload. It has to accept every payload type
+    // and return the same type for all of them.
+    template <class Visitor>
+    decltype(auto) visit(Visitor&& p_visitor) const
+    {
+        using Result = decltype(p_visitor(std::declval<Nth<0> const&>()));
+        return visitAt<Result>(p_visitor, Index<0>());
+    }
+
+private:
+    static constexpr bool c_trivial = detail::AllOf<std::is_trivially_copyable<Payloads>::value...>::value;
+    static constexpr std::uint8_t c_valueless = 255;
+
+    template <std::size_t I>
+    using Index = std::integral_constant<std::size_t, I>;
+
+    template <std::size_t I>
+    using Nth = typename std::tuple_element<I, std::tuple<Payloads...>>::type;
+
+    using Last = Nth<sizeof...(Payloads) - 1>;
+
+    struct CopyInto
+    {
+        template <class T>
+        void operator()(T const& p_payload) const { new (storage) T(p_payload); }
+
+        void* storage;
+    };
+
+    struct Destroy
+    {
+        template <class T>
+        void operator()(T const& p_payload) const { p_payload.~T(); }
+    };
+
+    struct ToEvent
+    {
+        template <class T>
+        std::unique_ptr<Event> operator()(T const& p_payload) const { return std::make_unique<EventT<T>>(p_payload); }
+    };
+
+    template <class T>
+    static constexpr std::uint8_t indexOf()
+    {
+        static_assert(canHold<T>(), "Type is not one of the TypedEvent payloads!");
+        return static_cast<std::uint8_t>(detail::IndexOf<T, Payloads...>::value);
+    }
+
+    template <class T>
+    T const& as() const noexcept { return *reinterpret_cast<T const*>(&m_storage); }
+
+    template <class Result, class Visitor, std::size_t I>
+    Result visitAt(Visitor& p_visitor, Index<I>) const
+    {
+        if (m_index == I) {
+            return p_visitor(as<Nth<I>>());
+        }
+        return visitAt<Result>(p_visitor, Index<I + 1>());
+    }
+
+    template <class Result, class Visitor>
+    Result visitAt(Visitor& p_visitor, Index<sizeof...(Payloads) - 1>) const
+    {
+        return p_visitor(as<Last>());
+    }
+
+    template <std::size_t I>
+    static TypedEvent fromAt(Event const& p_evt, Index<I>)
+    {
+        if (p_evt.getMessageId() == Nth<I>::MESSAGE_ID) {
+            return TypedEvent(*eventCast<Nth<I>>(p_evt));
+        }
+        return fromAt(p_evt, Index<I + 1>());
+    }
+
+    static TypedEvent fromAt(Event const&, Index<sizeof...(Payloads)>)
+    {
+        throw TypedEventError("Event does not hold any of the TypedEvent payload types.");
+    }
+
+    void destroy() noexcept
+    {
+        if (not c_trivial and not valueless()) {
+            visit(Destroy());
+        }
+    }
+
+    typename std::aligned_union<0, Payloads...>::type m_storage;
+    std::uint8_t m_index;
+};
+
+template <class... Payloads>
+constexpr bool TypedEvent<Payloads...>::c_trivial;
+
+template <class... Payloads>
+constexpr std::uint8_t TypedEvent<Payloads...>::c_valueless;
+
+template <class Visitor, class... Payloads>
+decltype(auto) visit(Visitor&& p_visitor, TypedEvent<Payloads...> const& p_evt)
+{
+    return p_evt.visit(std::forward<Visitor>(p_visitor));
+}
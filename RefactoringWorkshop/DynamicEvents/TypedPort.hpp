@@ -0,0 +1,97 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+
+#include "Event.hpp"
+#include "IEventHandler.hpp"
+#include "IPort.hpp"
+#include "TypedEvent.hpp"
+
+// Counterparts of IPort and IEventHandler for a closed set of payloads.
+// Events travel by reference to a TypedEvent, so sending one neither
+// allocates nor transfers ownership: a port that keeps an event copies it.
+template <class... Payloads>
+class ITypedPort
+{
+public:
+    using EventType = TypedEvent<Payloads...>;
+
+    virtual ~ITypedPort() = default;
+    virtual void send(EventType const&) = 0;
+
+    virtual void sendBatch(EventType const* p_events, std::size_t p_size)
+    {
+        for (std::size_t i = 0; i < p_size; ++i) {
+            send(p_events[i]);
+        }
+    }
+};
+
+template <class... Payloads>
+class ITypedEventHandler
+{
+public:
+    using EventType = TypedEvent<Payloads...>;
+
+    virtual ~ITypedEventHandler() = default;
+    virtual void receive(EventType const&) = 0;
+};
+
+// ITypedPort forwarding to an IPort, one EventT per event.
+template <class... Payloads>
+class TypedPortAdapter : public ITypedPort<Payloads...>
+{
+public:
+    using EventType = TypedEvent<Payloads...>;
+
+    explicit TypedPortAdapter(IPort& p_target)
+        : m_target(p_target)
+    {}
+
+    void send(EventType const& p_evt) override
+    {
+        m_target.send(p_evt.toEvent());
+    }
+
+private:
+    IPort& m_target;
+};
+
+// IPort forwarding to an ITypedPort. Throws TypedEventError for events
+// outside Payloads.
+template <class... Payloads>
+class EventPortAdapter : public IPort
+{
+public:
+    explicit EventPortAdapter(ITypedPort<Payloads...>& p_target)
+        : m_target(p_target)
+    {}
+
+    void send(std::unique_ptr<Event> p_evt) override
+    {
+        m_target.send(TypedEvent<Payloads...>::from(*p_evt));
+    }
+
+private:
+    ITypedPort<Payloads...>& m_target;
+};
+
+// IEventHandler forwarding to an ITypedEventHandler. Throws
+// TypedEventError for events outside Payloads.
+template <class... Payloads>
+class EventHandlerAdapter : public IEventHandler
+{
+public:
+    explicit EventHandlerAdapter(ITypedEventHandler<Payloads...>& p_target)
+        : m_target(p_target)
+    {}
+
+    void receive(std::unique_ptr<Event> p_evt) override
+    {
+        m_target.receive(TypedEvent<Payloads...>::from(*p_evt));
+    }
+
+private:
+    ITypedEventHandler<Payloads...>& m_target;
+};
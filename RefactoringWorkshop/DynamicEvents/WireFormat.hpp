@@ -0,0 +1,188 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+#include "Event.hpp"
+#include "EventT.hpp"
+#include "IEventHandler.hpp"
+#include "IPort.hpp"
+
+// Every record is a WireHeader followed by the raw payload bytes, padded
+// with zeros so that the next record starts on a wireAlignment boundary.
+// Byte order is the host's: the format is meant for processes on the
+// same kind of machine.
+struct WireHeader
+{
+    std::uint32_t messageId;
+    std::uint32_t length; // payload bytes, padding excluded
+};
+
+constexpr std::size_t wireAlignment = 8;
+
+struct WireFormatError : std::runtime_error
+{
+    explicit WireFormatError(char const* p_what)
+        : std::runtime_error(p_what)
+    {}
+};
+
+// Encodes and decodes events whose payload type is one of Payloads. All of
+// them must be trivially copyable; empty payloads take no bytes on the wire.
+//
+// Decoding does not copy: each decoded event is an EventT borrowing its
+// payload straight from the buffer (see BorrowPayload), so the buffer has
+// to stay alive and unmodified while the events are in use, and has to be
+// aligned to wireAlignment.
+template <class... Payloads>
+class WireCodec
+{
+public:
+    static std::size_t recordSize(std::uint32_t p_length)
+    {
+        return sizeof(WireHeader) + (p_length + wireAlignment - 1) / wireAlignment * wireAlignment;
+    }
+
+    // Appends one record. Throws WireFormatError for an event outside Payloads.
+    static void encode(Event const& p_evt, std::vector<unsigned char>& p_out)
+    {
+        Entry const& l_entry = entry(p_evt.getMessageId());
+
+        std::size_t const l_offset = p_out.size();
+        p_out.resize(l_offset + recordSize(l_entry.length), 0);
+
+        WireHeader const l_header = {p_evt.getMessageId(), l_entry.length};
+        std::memcpy(p_out.data() + l_offset, &l_header, sizeof(l_header));
+        l_entry.write(p_evt, p_out.data() + l_offset + sizeof(l_header));
+    }
+
+    // Appends one record per event. The events are only read.
+    static void encode(EventBatch p_events, std::vector<unsigned char>& p_out)
+    {
+        for (auto const& l_evt : p_events) {
+            encode(*l_evt, p_out);
+        }
+    }
+
+    // Decodes the record at the start of p_data and sets p_consumed to its
+    // size. Returns nullptr, consuming nothing, when p_data does not hold a
+    // whole record yet.
+    static std::unique_ptr<Event> decode(unsigned char* p_data, std::size_t p_size, std::size_t& p_consumed)
+    {
+        p_consumed = 0;
+        if (p_size < sizeof(WireHeader)) {
+            return nullptr;
+        }
+
+        WireHeader l_header;
+        std::memcpy(&l_header, p_data, sizeof(l_header));
+
+        Entry const& l_entry = entry(l_header.messageId);
+        if (l_header.length != l_entry.length) {
+            throw WireFormatError("Wire record length does not match its message id.");
+        }
+
+        std::size_t const l_recordSize = recordSize(l_header.length);
+        if (p_size < l_recordSize) {
+            return nullptr;
+        }
+
+        p_consumed = l_recordSize;
+        return l_entry.view(p_data + sizeof(WireHeader));
+    }
+
+    // Decodes every whole record in p_data and hands the events to
+    // p_handler in order. Returns the bytes consumed; a trailing partial
+    // record is left for the caller to complete.
+    static std::size_t decode(unsigned char* p_data, std::size_t p_size, IEventHandler& p_handler)
+    {
+        if (reinterpret_cast<std::uintptr_t>(p_data) % wireAlignment) {
+            throw WireFormatError("Wire buffer is not aligned.");
+        }
+
+        std::size_t l_offset = 0;
+        while (true) {
+            std::size_t l_consumed;
+            auto l_evt = decode(p_data + l_offset, p_size - l_offset, l_consumed);
+            if (not l_evt) {
+                return l_offset;
+            }
+            l_offset += l_consumed;
+            p_handler.receive(std::move(l_evt));
+        }
+    }
+
+private:
+    static constexpr std::uint32_t c_unknown = std::numeric_limits<std::uint32_t>::max();
+
+    struct Entry
+    {
+        std::uint32_t length;
+        void (*write)(Event const&, unsigned char*);
+        std::unique_ptr<Event> (*view)(unsigned char*);
+    };
+
+    template <class T>
+    static std::uint32_t lengthOf()
+    {
+        static_assert(std::is_trivially_copyable<T>::value, "Wire payloads must be trivially copyable!");
+        return std::is_empty<T>::value ? 0 : sizeof(T);
+    }
+
+    template <class T>
+    static void write(Event const& p_evt, unsigned char* p_out)
+    {
+        std::memcpy(p_out, &*eventCast<T>(p_evt), lengthOf<T>());
+    }
+
+    template <class T>
+    static std::unique_ptr<Event> view(unsigned char* p_payload)
+    {
+        return view<T>(p_payload, std::is_empty<T>());
+    }
+
+    template <class T>
+    static std::unique_ptr<Event> view(unsigned char*, std::true_type)
+    {
+        return std::make_unique<EventT<T>>();
+    }
+
+    template <class T>
+    static std::unique_ptr<Event> view(unsigned char* p_payload, std::false_type)
+    {
+        return std::make_unique<EventT<T>>(borrowPayload, *reinterpret_cast<T*>(p_payload));
+    }
+
+    template <class T>
+    static void add(std::vector<Entry>& p_table)
+    {
+        if (T::MESSAGE_ID >= p_table.size()) {
+            p_table.resize(T::MESSAGE_ID + 1, Entry{c_unknown, nullptr, nullptr});
+        }
+        p_table[T::MESSAGE_ID] = Entry{lengthOf<T>(), &write<T>, &view<T>};
+    }
+
+    static std::vector<Entry> makeTable()
+    {
+        std::vector<Entry> l_table;
+        int l_expand[] = {0, (add<Payloads>(l_table), 0)...};
+        (void)l_expand;
+        return l_table;
+    }
+
+    static Entry const& entry(std::uint32_t p_messageId)
+    {
+        static std::vector<Entry> const s_table = makeTable();
+
+        if (p_messageId >= s_table.size() or s_table[p_messageId].length == c_unknown) {
+            throw WireFormatError("Message id is not part of the wire protocol.");
+        }
+        return s_table[p_messageId];
+    }
+};
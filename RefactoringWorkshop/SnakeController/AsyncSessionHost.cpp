@@ -0,0 +1,116 @@
+#include "AsyncSessionHost.hpp"
+
+#include <exception>
+
+#include "EventT.hpp"
+#include "IEventHandler.hpp"
+#include "IPort.hpp"
+#include "SnakeController.hpp"
+
+namespace Snake
+{
+
+class AsyncSessionHost::FoodPort : public IPort
+{
+public:
+    FoodPort(AsyncSessionHost& p_host, Session& p_session)
+        : m_host(p_host),
+          m_session(p_session)
+    {}
+
+    void send(std::unique_ptr<Event> p_evt) override
+    {
+        if (p_evt->getMessageId() != FoodReq::MESSAGE_ID) {
+            throw UnexpectedEventException();
+        }
+        m_host.requestFood(m_session);
+    }
+
+private:
+    AsyncSessionHost& m_host;
+    Session& m_session;
+};
+
+// Receives the events posted to the session.
+struct AsyncSessionHost::Session : IEventHandler
+{
+    explicit Session(AsyncSessionHost& p_host)
+        : host(p_host),
+          foodPort(p_host, *this),
+          tickTimer(0)
+    {}
+
+    void receive(std::unique_ptr<Event> p_evt) override { host.deliver(*this, std::move(p_evt)); }
+
+    AsyncSessionHost& host;
+    FoodPort foodPort;
+    std::unique_ptr<Controller> controller;
+    EventLoop::TimerId tickTimer;
+};
+
+AsyncSessionHost::AsyncSessionHost(EventLoop& p_loop, EventLoop::Clock::duration p_tickPeriod,
+                                   EventLoop::Clock::duration p_foodDelay, unsigned p_seed)
+    : m_loop(p_loop),
+      m_tickPeriod(p_tickPeriod),
+      m_foodDelay(p_foodDelay),
+      m_random(p_seed + 1)
+{}
+
+AsyncSessionHost::~AsyncSessionHost()
+{
+    for (auto const& l_session : m_sessions) {
+        m_loop.cancelTimer(l_session->tickTimer);
+    }
+    for (auto const l_timer : m_foodTimers) {
+        m_loop.cancelTimer(l_timer);
+    }
+}
+
+AsyncSessionHost::SessionId AsyncSessionHost::createSession(IPort& p_displayPort, IPort& p_scorePort,
+                                                            std::string const& p_config)
+{
+    auto l_session = std::make_unique<Session>(*this);
+    l_session->controller = std::make_unique<Controller>(p_displayPort, l_session->foodPort, p_scorePort, p_config);
+
+    Session* const l_target = l_session.get();
+    l_session->tickTimer = m_loop.startTimer(m_loop.now() + m_tickPeriod, m_tickPeriod, [this, l_target] {
+        ++m_stats.ticks;
+        deliver(*l_target, std::make_unique<EventT<TimeoutInd>>());
+    });
+
+    m_sessions.push_back(std::move(l_session));
+    return m_sessions.size() - 1;
+}
+
+void AsyncSessionHost::post(SessionId p_session, std::unique_ptr<Event> p_evt)
+{
+    m_loop.post(*m_sessions.at(p_session), std::move(p_evt));
+}
+
+void AsyncSessionHost::deliver(Session& p_session, std::unique_ptr<Event> p_evt)
+{
+    try {
+        p_session.controller->receive(std::move(p_evt));
+    } catch (std::exception const&) {
+        ++m_stats.errors;
+    }
+}
+
+void AsyncSessionHost::requestFood(Session& p_session)
+{
+    ++m_stats.foodRequests;
+
+    auto const l_timer = std::make_shared<EventLoop::TimerId>(0);
+    *l_timer = m_loop.startTimer(m_loop.now() + m_foodDelay, [this, &p_session, l_timer] {
+        m_foodTimers.erase(*l_timer);
+        ++m_stats.foodResponses;
+
+        OccupancyGrid const& l_map = p_session.controller->occupancy();
+        FoodResp const l_food{std::uniform_int_distribution<int>(0, l_map.width() - 1)(m_random),
+                              std::uniform_int_distribution<int>(0, l_map.height() - 1)(m_random)};
+        deliver(p_session, std::make_unique<EventT<FoodResp>>(l_food));
+    });
+    m_foodTimers.insert(*l_timer);
+}
+
+} // namespace Snake
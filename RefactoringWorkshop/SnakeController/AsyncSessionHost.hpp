@@ -0,0 +1,75 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#include "EventLoop.hpp"
+
+class Event;
+class IPort;
+
+namespace Snake
+{
+class Controller;
+
+struct AsyncSessionStats
+{
+    std::uint64_t ticks = 0;         // TimeoutInd deliveries
+    std::uint64_t foodRequests = 0;  // FoodReq sent by controllers
+    std::uint64_t foodResponses = 0; // FoodResp delivered
+    std::uint64_t errors = 0;        // events a controller rejected with an exception
+};
+
+// Runs Snake::Controller sessions as tasks of one EventLoop. Every session
+// is ticked by a periodic timer. Its food port is an asynchronous food
+// service answering each FoodReq, after p_foodDelay, with a FoodResp at a
+// random cell of the session's map; a session waiting for food costs one
+// pending timer, not a thread.
+//
+// Everything, creation included, runs on the loop's thread. Destroying the
+// host cancels its timers; events posted to its sessions must have been
+// delivered by then.
+class AsyncSessionHost
+{
+public:
+    using SessionId = std::size_t;
+
+    AsyncSessionHost(EventLoop& p_loop, EventLoop::Clock::duration p_tickPeriod,
+                     EventLoop::Clock::duration p_foodDelay, unsigned p_seed = 0);
+    ~AsyncSessionHost();
+
+    AsyncSessionHost(AsyncSessionHost const&) = delete;
+    AsyncSessionHost& operator=(AsyncSessionHost const&) = delete;
+
+    // The first tick comes one period from now. Throws ConfigurationError
+    // for a bad config.
+    SessionId createSession(IPort& p_displayPort, IPort& p_scorePort, std::string const& p_config);
+
+    // Delivers p_evt, e.g. a DirectionInd, from the loop. Throws
+    // std::out_of_range for an unknown session.
+    void post(SessionId p_session, std::unique_ptr<Event> p_evt);
+
+    std::size_t sessionCount() const { return m_sessions.size(); }
+    AsyncSessionStats const& stats() const { return m_stats; }
+
+private:
+    class FoodPort;
+    struct Session;
+
+    void deliver(Session& p_session, std::unique_ptr<Event> p_evt);
+    void requestFood(Session& p_session);
+
+    EventLoop& m_loop;
+    EventLoop::Clock::duration m_tickPeriod;
+    EventLoop::Clock::duration m_foodDelay;
+    std::minstd_rand m_random;
+    std::vector<std::unique_ptr<Session>> m_sessions;
+    std::unordered_set<EventLoop::TimerId> m_foodTimers;
+    AsyncSessionStats m_stats;
+};
+
+} // namespace Snake
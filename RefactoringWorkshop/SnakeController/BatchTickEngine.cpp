@@ -0,0 +1,212 @@
+#include "BatchTickEngine.hpp"
+
+#include "EventT.hpp"
+#include "IPort.hpp"
+
+namespace Snake
+{
+namespace
+{
+
+enum Outcome : std::int32_t
+{
+    Outcome_MOVE = 0,
+    Outcome_EAT  = 1,
+    Outcome_WALL = 2
+};
+
+// Branch free, so that it vectorizes: Direction keeps the axis in bit 0
+// and the sign in bit 1.
+void computeNextHeads(std::int32_t const* p_headX, std::int32_t const* p_headY,
+                      std::int32_t const* p_direction,
+                      std::int32_t* p_nextX, std::int32_t* p_nextY, std::size_t p_count)
+{
+    for (std::size_t i = 0; i < p_count; ++i) {
+        std::int32_t const l_horizontal = p_direction[i] & 0b01;
+        std::int32_t const l_sign = (p_direction[i] & 0b10) - 1;
+        p_nextX[i] = p_headX[i] + l_horizontal * l_sign;
+        p_nextY[i] = p_headY[i] + (l_horizontal ^ 1) * l_sign;
+    }
+}
+
+// Eating takes precedence over hitting the wall, as in Controller.
+void computeOutcomes(std::int32_t const* p_nextX, std::int32_t const* p_nextY,
+                     std::int32_t const* p_foodX, std::int32_t const* p_foodY,
+                     std::int32_t const* p_width, std::int32_t const* p_height,
+                     std::int32_t* p_outcome, std::size_t p_count)
+{
+    for (std::size_t i = 0; i < p_count; ++i) {
+        std::int32_t const l_eat = (p_nextX[i] == p_foodX[i]) & (p_nextY[i] == p_foodY[i]);
+        std::int32_t const l_wall = (std::uint32_t(p_nextX[i]) >= std::uint32_t(p_width[i]))
+                                  | (std::uint32_t(p_nextY[i]) >= std::uint32_t(p_height[i]));
+        p_outcome[i] = l_eat * Outcome_EAT + (l_wall & (l_eat ^ 1)) * Outcome_WALL;
+    }
+}
+
+} // namespace
+
+BatchTickEngine::BatchTickEngine() = default;
+
+BatchTickEngine::~BatchTickEngine() = default;
+
+BatchTickEngine::GameId BatchTickEngine::addGame(IPort& p_displayPort, IPort& p_foodPort, IPort& p_scorePort,
+                                                 std::string const& p_config)
+{
+    TextConfigReader l_reader(p_config);
+    return addGame(Ports{&p_displayPort, &p_foodPort, &p_scorePort}, l_reader);
+}
+
+BatchTickEngine::GameId BatchTickEngine::addGame(IPort& p_displayPort, IPort& p_foodPort, IPort& p_scorePort,
+                                                 BinaryConfig p_config)
+{
+    BinaryConfigReader l_reader(p_config);
+    return addGame(Ports{&p_displayPort, &p_foodPort, &p_scorePort}, l_reader);
+}
+
+template <class Reader>
+BatchTickEngine::GameId BatchTickEngine::addGame(Ports p_ports, Reader& p_reader)
+{
+    Body l_body;
+    l_body.age = 0;
+    ConfigHeader const l_header = readSnake(p_reader, l_body.segments, l_body.occupancy);
+
+    m_headX.push_back(l_body.segments.front().x);
+    m_headY.push_back(l_body.segments.front().y);
+    m_direction.push_back(l_header.direction);
+    m_foodX.push_back(l_header.foodX);
+    m_foodY.push_back(l_header.foodY);
+    m_width.push_back(l_header.width);
+    m_height.push_back(l_header.height);
+    m_length.push_back(static_cast<std::uint32_t>(l_header.length));
+    m_nextX.push_back(0);
+    m_nextY.push_back(0);
+    m_outcome.push_back(Outcome_MOVE);
+    m_bodies.push_back(std::move(l_body));
+    m_ports.push_back(p_ports);
+
+    return m_headX.size() - 1;
+}
+
+void BatchTickEngine::tick()
+{
+    move(0, size());
+
+    for (GameId l_game = 0; l_game < size(); ++l_game) {
+        advance(l_game);
+    }
+}
+
+struct BatchTickEngine::InputVisitor
+{
+    void operator()(TimeoutInd const&) const
+    {
+        engine.move(game, game + 1);
+        engine.advance(game);
+    }
+    void operator()(DirectionInd const& p_evt) const { engine.changeDirection(game, p_evt.direction); }
+    void operator()(FoodInd const& p_evt) const { engine.placeFood(game, p_evt.x, p_evt.y, true); }
+    void operator()(FoodResp const& p_evt) const { engine.placeFood(game, p_evt.x, p_evt.y, false); }
+
+    BatchTickEngine& engine;
+    GameId game;
+};
+
+void BatchTickEngine::receive(GameId p_game, ControllerInput const& p_evt)
+{
+    p_evt.visit(InputVisitor{*this, p_game});
+}
+
+void BatchTickEngine::move(GameId p_first, GameId p_last)
+{
+    std::size_t const l_count = p_last - p_first;
+    if (l_count == 0) {
+        return;
+    }
+
+    computeNextHeads(&m_headX[p_first], &m_headY[p_first], &m_direction[p_first],
+                     &m_nextX[p_first], &m_nextY[p_first], l_count);
+    computeOutcomes(&m_nextX[p_first], &m_nextY[p_first], &m_foodX[p_first], &m_foodY[p_first],
+                    &m_width[p_first], &m_height[p_first], &m_outcome[p_first], l_count);
+}
+
+// Controller::handleTimeoutInd() for the move computed by move().
+void BatchTickEngine::advance(GameId p_game)
+{
+    Body& l_body = m_bodies[p_game];
+    Ports const& l_ports = m_ports[p_game];
+    std::int32_t const l_nextX = m_nextX[p_game];
+    std::int32_t const l_nextY = m_nextY[p_game];
+    m_displayBatch.clear();
+
+    if (l_body.occupancy.test(l_nextX, l_nextY) or m_outcome[p_game] == Outcome_WALL) {
+        l_ports.score->send(std::make_unique<EventT<LooseInd>>());
+        return;
+    }
+
+    std::int64_t const l_headTtl = l_body.segments.front().expiry - l_body.age;
+
+    if (m_outcome[p_game] == Outcome_EAT) {
+        l_ports.score->send(std::make_unique<EventT<ScoreInd>>());
+        l_ports.food->send(std::make_unique<EventT<FoodReq>>());
+    } else {
+        ageSegments(p_game);
+    }
+
+    l_body.segments.push_front(SnakeSegment{l_nextX, l_nextY, l_body.age + l_headTtl});
+    l_body.occupancy.set(l_nextX, l_nextY);
+    m_headX[p_game] = l_nextX;
+    m_headY[p_game] = l_nextY;
+    m_length[p_game] = static_cast<std::uint32_t>(l_body.segments.size());
+
+    display(l_nextX, l_nextY, Cell_SNAKE);
+    flushDisplay(p_game);
+}
+
+void BatchTickEngine::ageSegments(GameId p_game)
+{
+    Body& l_body = m_bodies[p_game];
+    ++l_body.age;
+
+    expireSegments(l_body.segments, l_body.age, [this, &l_body](SnakeSegment const& p_segment) {
+        l_body.occupancy.reset(p_segment.x, p_segment.y);
+        display(p_segment.x, p_segment.y, Cell_FREE);
+    });
+}
+
+void BatchTickEngine::changeDirection(GameId p_game, Direction p_direction)
+{
+    if ((m_direction[p_game] & 0b01) != (p_direction & 0b01)) {
+        m_direction[p_game] = p_direction;
+    }
+}
+
+void BatchTickEngine::placeFood(GameId p_game, int p_x, int p_y, bool p_clearOld)
+{
+    m_displayBatch.clear();
+
+    if (m_bodies[p_game].occupancy.test(p_x, p_y)) {
+        m_ports[p_game].food->send(std::make_unique<EventT<FoodReq>>());
+    } else {
+        if (p_clearOld) {
+            display(m_foodX[p_game], m_foodY[p_game], Cell_FREE);
+        }
+        display(p_x, p_y, Cell_FOOD);
+        flushDisplay(p_game);
+    }
+
+    m_foodX[p_game] = p_x;
+    m_foodY[p_game] = p_y;
+}
+
+void BatchTickEngine::display(int p_x, int p_y, Cell p_value)
+{
+    m_displayBatch.push_back(std::make_unique<EventT<DisplayInd>>(DisplayInd{p_x, p_y, p_value}));
+}
+
+void BatchTickEngine::flushDisplay(GameId p_game)
+{
+    m_ports[p_game].display->sendBatch(EventBatch{m_displayBatch.data(), m_displayBatch.size()});
+    m_displayBatch.clear();
+}
+
+} // namespace Snake
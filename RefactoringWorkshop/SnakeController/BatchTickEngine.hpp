@@ -0,0 +1,102 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "ConfigReader.hpp"
+#include "OccupancyGrid.hpp"
+#include "RingBuffer.hpp"
+#include "SnakeBody.hpp"
+#include "SnakeController.hpp"
+#include "SnakeInterface.hpp"
+
+class Event;
+class IPort;
+
+namespace Snake
+{
+
+// Runs many independent games by the rules of Snake::Controller, sending
+// the same events to each game's ports as a Controller would. Heads,
+// directions, food positions, lengths and map dimensions are kept in one
+// array per field, so tick() computes the next head, the wall check and
+// the food check of every game in loops the compiler vectorizes. Only the
+// body update, which touches per game memory, runs game by game.
+class BatchTickEngine
+{
+public:
+    using GameId = std::size_t;
+
+    BatchTickEngine();
+    ~BatchTickEngine();
+
+    BatchTickEngine(BatchTickEngine const& p_rhs) = delete;
+    BatchTickEngine& operator=(BatchTickEngine const& p_rhs) = delete;
+
+    // Throws ConfigurationError for a bad config, as Controller does.
+    GameId addGame(IPort& p_displayPort, IPort& p_foodPort, IPort& p_scorePort, std::string const& p_config);
+    GameId addGame(IPort& p_displayPort, IPort& p_foodPort, IPort& p_scorePort, BinaryConfig p_config);
+
+    // Delivers a TimeoutInd to every game, in GameId order.
+    void tick();
+
+    // Delivers p_evt to p_game only.
+    void receive(GameId p_game, ControllerInput const& p_evt);
+
+    std::size_t size() const { return m_headX.size(); }
+    std::size_t length(GameId p_game) const { return m_length[p_game]; }
+
+private:
+    struct InputVisitor;
+
+    // State that does not fit in a lane: see Controller for its meaning.
+    struct Body
+    {
+        std::int64_t age;
+        RingBuffer<SnakeSegment> segments;
+        OccupancyGrid occupancy;
+    };
+
+    struct Ports
+    {
+        IPort* display;
+        IPort* food;
+        IPort* score;
+    };
+
+    template <class Reader>
+    GameId addGame(Ports p_ports, Reader& p_reader);
+
+    void move(GameId p_first, GameId p_last);
+    void advance(GameId p_game);
+    void ageSegments(GameId p_game);
+    void changeDirection(GameId p_game, Direction p_direction);
+    void placeFood(GameId p_game, int p_x, int p_y, bool p_clearOld);
+    void display(int p_x, int p_y, Cell p_value);
+    void flushDisplay(GameId p_game);
+
+    // One lane per game.
+    std::vector<std::int32_t> m_headX;
+    std::vector<std::int32_t> m_headY;
+    std::vector<std::int32_t> m_direction;
+    std::vector<std::int32_t> m_foodX;
+    std::vector<std::int32_t> m_foodY;
+    std::vector<std::int32_t> m_width;
+    std::vector<std::int32_t> m_height;
+    std::vector<std::uint32_t> m_length;
+
+    // Results of move(), consumed by advance().
+    std::vector<std::int32_t> m_nextX;
+    std::vector<std::int32_t> m_nextY;
+    std::vector<std::int32_t> m_outcome;
+
+    std::vector<Body> m_bodies;
+    std::vector<Ports> m_ports;
+
+    std::vector<std::unique_ptr<Event>> m_displayBatch;
+};
+
+} // namespace Snake
@@ -0,0 +1,74 @@
+#include "BatchTickEngine.hpp"
+#include "SnakeController.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include "BenchmarkConfigs.hpp"
+#include "EventT.hpp"
+#include "NullPort.hpp"
+
+namespace Snake
+{
+namespace
+{
+
+int const c_batchRoom = 1 << 10;
+
+// One TimeoutInd for each of N games, a Controller per game. Games are
+// rebuilt outside of the timed region before their snakes reach the wall.
+void BM_ControllerTickByGameCount(benchmark::State& state)
+{
+    std::size_t const l_games = static_cast<std::size_t>(state.range(0));
+    std::string const l_config = straightSnakeConfig(10, c_batchRoom);
+
+    NullPort l_displayPort, l_foodPort, l_scorePort;
+    EventT<TimeoutInd> l_timeout;
+    std::vector<std::unique_ptr<Controller>> l_sut;
+    int l_ticksLeft = 0;
+
+    for (auto _ : state) {
+        if (not l_ticksLeft--) {
+            state.PauseTiming();
+            l_sut.clear();
+            for (std::size_t i = 0; i < l_games; ++i) {
+                l_sut.push_back(std::make_unique<Controller>(l_displayPort, l_foodPort, l_scorePort, l_config));
+            }
+            l_ticksLeft = c_batchRoom - 2;
+            state.ResumeTiming();
+        }
+        for (auto const& l_controller : l_sut) {
+            l_controller->receive(l_timeout.clone());
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ControllerTickByGameCount)->RangeMultiplier(8)->Range(1, 4096);
+
+// The same games run by one BatchTickEngine.
+void BM_BatchTickByGameCount(benchmark::State& state)
+{
+    std::size_t const l_games = static_cast<std::size_t>(state.range(0));
+    std::string const l_config = straightSnakeConfig(10, c_batchRoom);
+
+    NullPort l_displayPort, l_foodPort, l_scorePort;
+    std::unique_ptr<BatchTickEngine> l_sut;
+    int l_ticksLeft = 0;
+
+    for (auto _ : state) {
+        if (not l_ticksLeft--) {
+            state.PauseTiming();
+            l_sut = std::make_unique<BatchTickEngine>();
+            for (std::size_t i = 0; i < l_games; ++i) {
+                l_sut->addGame(l_displayPort, l_foodPort, l_scorePort, l_config);
+            }
+            l_ticksLeft = c_batchRoom - 2;
+            state.ResumeTiming();
+        }
+        l_sut->tick();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_BatchTickByGameCount)->RangeMultiplier(8)->Range(1, 4096);
+
+} // namespace
+} // namespace Snake
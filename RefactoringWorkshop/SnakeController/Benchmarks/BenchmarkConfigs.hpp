@@ -0,0 +1,25 @@
+#pragma once
+
+#include <string>
+
+namespace Snake
+{
+
+// Snake of p_length segments lying on row 0 of a p_length + p_room wide,
+// p_height high map, head at x = p_length - 1 and heading right, so it
+// can take p_room - 1 ticks before reaching the wall. Food is parked at
+// the bottom-right corner, out of its way.
+inline std::string straightSnakeConfig(int p_length, int p_room, int p_height = 2)
+{
+    int const l_width = p_length + p_room;
+    std::string l_config = "W " + std::to_string(l_width) + " " + std::to_string(p_height)
+        + " F " + std::to_string(l_width - 1) + " " + std::to_string(p_height - 1)
+        + " S R " + std::to_string(p_length);
+
+    for (int x = p_length - 1; x >= 0; --x) {
+        l_config += " " + std::to_string(x) + " 0";
+    }
+    return l_config;
+}
+
+} // namespace Snake
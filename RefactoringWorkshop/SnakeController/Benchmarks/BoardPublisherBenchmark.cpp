@@ -0,0 +1,185 @@
+#include "BoardPublisher.hpp"
+#include "SnakeController.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "BenchmarkConfigs.hpp"
+#include "ControllerMetrics.hpp"
+#include "EventT.hpp"
+#include "FramebufferPort.hpp"
+#include "NullPort.hpp"
+
+namespace Snake
+{
+namespace
+{
+
+int const c_publishedRoom = 1 << 16;
+
+// Reader threads copying the latest board over and over until stopped.
+// Only the reads that got a board are counted.
+template <class Board>
+class Spectators
+{
+public:
+    template <class Read>
+    Spectators(int p_count, Read p_read)
+        : m_stop(false), m_reads(0), m_start(std::chrono::steady_clock::now())
+    {
+        for (int i = 0; i < p_count; ++i) {
+            m_threads.emplace_back([this, p_read] {
+                Board l_board;
+                std::uint64_t l_reads = 0;
+                while (not m_stop.load(std::memory_order_relaxed)) {
+                    l_reads += p_read(l_board);
+                }
+                m_reads += l_reads;
+            });
+        }
+    }
+
+    // Returns the reads done per second since the start. Timed here, as
+    // readers go on while the benchmark's timer is paused.
+    double stop()
+    {
+        m_stop = true;
+        for (auto& l_thread : m_threads) {
+            l_thread.join();
+        }
+        std::chrono::duration<double> const l_elapsed = std::chrono::steady_clock::now() - m_start;
+        return static_cast<double>(m_reads) / l_elapsed.count();
+    }
+
+private:
+    std::atomic<bool> m_stop;
+    std::atomic<std::uint64_t> m_reads;
+    std::chrono::steady_clock::time_point m_start;
+    std::vector<std::thread> m_threads;
+};
+
+void reportTicks(benchmark::State& state, LatencyHistogram const& p_ticks, double p_readsPerSecond)
+{
+    state.counters["tick_p50_ns"] = static_cast<double>(p_ticks.percentile(50));
+    state.counters["tick_p99_ns"] = static_cast<double>(p_ticks.percentile(99));
+    state.counters["tick_max_ns"] = static_cast<double>(p_ticks.max());
+    state.counters["reads_per_s"] = p_readsPerSecond;
+    state.SetItemsProcessed(state.iterations());
+}
+
+// Ticks of a snake of the given length publishing its board, with N
+// threads reading the latest one as fast as they can. A tick publishes the
+// two cells it drew whatever the length; readers copy the whole board. The
+// tick latency is wall-clock, so it includes the time the writer spent
+// preempted when readers outnumber cores.
+void BM_PublishedTick(benchmark::State& state)
+{
+    NullPort l_port;
+    int const l_length = static_cast<int>(state.range(0));
+    std::string const l_config = straightSnakeConfig(l_length, c_publishedRoom);
+    BoardPublisher l_publisher(l_length + c_publishedRoom, 2);
+    std::unique_ptr<Controller> l_controller;
+    EventT<TimeoutInd> l_timeout;
+    LatencyHistogram l_ticks;
+    int l_ticksLeft = 0;
+
+    Spectators<PublishedBoard> l_spectators(static_cast<int>(state.range(1)),
+                            [&l_publisher](PublishedBoard& p_out) { return l_publisher.read(p_out) != 0; });
+
+    for (auto _ : state) {
+        if (not l_ticksLeft--) {
+            state.PauseTiming();
+            l_controller = std::make_unique<Controller>(l_port, l_port, l_port, l_config);
+            l_controller->publishBoard(&l_publisher);
+            l_ticksLeft = c_publishedRoom - 2;
+            state.ResumeTiming();
+        }
+        auto const l_start = std::chrono::steady_clock::now();
+        l_controller->receive(l_timeout.clone());
+        l_ticks.record(static_cast<std::uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - l_start).count()));
+    }
+
+    reportTicks(state, l_ticks, l_spectators.stop());
+}
+
+void spectatedTickArgs(benchmark::internal::Benchmark* p_benchmark)
+{
+    p_benchmark->ArgNames({"length", "readers"});
+    for (int const l_length : {64, 1 << 10, 100000}) {
+        for (int const l_readers : {0, 1, 4, 16, 64}) {
+            p_benchmark->Args({l_length, l_readers});
+        }
+    }
+}
+BENCHMARK(BM_PublishedTick)->Apply(spectatedTickArgs)->UseRealTime();
+
+// Display port keeping the board under a mutex that readers take too.
+class LockedFramebuffer : public IPort
+{
+public:
+    LockedFramebuffer(int p_width, int p_height) : m_board(p_width, p_height) {}
+
+    void send(std::unique_ptr<Event> p_evt) override
+    {
+        std::lock_guard<std::mutex> l_lock(m_mutex);
+        m_board.send(std::move(p_evt));
+    }
+
+    void sendBatch(EventBatch p_events) override
+    {
+        std::lock_guard<std::mutex> l_lock(m_mutex);
+        m_board.sendBatch(p_events);
+    }
+
+    void read(std::vector<std::uint64_t>& p_out)
+    {
+        std::lock_guard<std::mutex> l_lock(m_mutex);
+        p_out = m_board.frame();
+    }
+
+private:
+    std::mutex m_mutex;
+    FramebufferPort m_board;
+};
+
+// The same with the board handed over under a mutex, for comparison: here
+// the writer waits for every reader copying at the time.
+void BM_LockedTick(benchmark::State& state)
+{
+    NullPort l_port;
+    int const l_length = static_cast<int>(state.range(0));
+    std::string const l_config = straightSnakeConfig(l_length, c_publishedRoom);
+    LockedFramebuffer l_board(l_length + c_publishedRoom, 2);
+    std::unique_ptr<Controller> l_controller;
+    EventT<TimeoutInd> l_timeout;
+    LatencyHistogram l_ticks;
+    int l_ticksLeft = 0;
+
+    Spectators<std::vector<std::uint64_t>> l_spectators(static_cast<int>(state.range(1)),
+                            [&l_board](std::vector<std::uint64_t>& p_out) { l_board.read(p_out); return true; });
+
+    for (auto _ : state) {
+        if (not l_ticksLeft--) {
+            state.PauseTiming();
+            l_controller = std::make_unique<Controller>(l_board, l_port, l_port, l_config);
+            l_ticksLeft = c_publishedRoom - 2;
+            state.ResumeTiming();
+        }
+        auto const l_start = std::chrono::steady_clock::now();
+        l_controller->receive(l_timeout.clone());
+        l_ticks.record(static_cast<std::uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - l_start).count()));
+    }
+
+    reportTicks(state, l_ticks, l_spectators.stop());
+}
+BENCHMARK(BM_LockedTick)->Apply(spectatedTickArgs)->UseRealTime();
+
+} // namespace
+} // namespace Snake
@@ -0,0 +1,91 @@
+#include <algorithm>
+#include <cstdint>
+#include <list>
+
+#include <benchmark/benchmark.h>
+
+#include "RingBuffer.hpp"
+
+namespace Snake
+{
+namespace
+{
+
+// Body bookkeeping of one plain move (no food, no collision), with the
+// list + per-segment TTL sweep the controller used to do and with the
+// ring buffer + expiry it does now.
+struct TtlSegment
+{
+    int x;
+    int y;
+    int ttl;
+};
+
+struct ExpirySegment
+{
+    int x;
+    int y;
+    std::int64_t expiry;
+};
+
+void BM_ListBodyTick(benchmark::State& state)
+{
+    int const l_length = static_cast<int>(state.range(0));
+    std::list<TtlSegment> l_segments;
+    for (int i = 0; i < l_length; ++i) {
+        l_segments.push_back(TtlSegment{l_length - 1 - i, 0, l_length - i});
+    }
+
+    std::size_t l_freed = 0;
+    for (auto _ : state) {
+        TtlSegment l_newHead = l_segments.front();
+        ++l_newHead.x;
+
+        for (auto& l_segment : l_segments) {
+            if (not --l_segment.ttl) {
+                ++l_freed;
+            }
+        }
+        l_segments.push_front(l_newHead);
+        l_segments.erase(
+            std::remove_if(
+                l_segments.begin(),
+                l_segments.end(),
+                [](auto const& segment){ return not (segment.ttl > 0); }),
+            l_segments.end());
+    }
+    benchmark::DoNotOptimize(l_freed);
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_ListBodyTick)->Arg(10)->Arg(1000)->Arg(100000);
+
+void BM_RingBodyTick(benchmark::State& state)
+{
+    int const l_length = static_cast<int>(state.range(0));
+    std::int64_t l_age = 0;
+    RingBuffer<ExpirySegment> l_segments;
+    for (int i = 0; i < l_length; ++i) {
+        l_segments.push_back(ExpirySegment{l_length - 1 - i, 0, l_length - i});
+    }
+
+    std::size_t l_freed = 0;
+    for (auto _ : state) {
+        ExpirySegment l_newHead = l_segments.front();
+        std::int64_t const l_headTtl = l_newHead.expiry - l_age;
+        ++l_newHead.x;
+
+        ++l_age;
+        while (not l_segments.empty() and l_segments.back().expiry <= l_age) {
+            l_segments.pop_back();
+            ++l_freed;
+        }
+        l_newHead.expiry = l_age + l_headTtl;
+        l_segments.push_front(l_newHead);
+    }
+    benchmark::DoNotOptimize(l_freed);
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_RingBodyTick)->Arg(10)->Arg(1000)->Arg(100000);
+
+} // namespace
+} // namespace Snake
@@ -0,0 +1,166 @@
+#include "SnakeController.hpp"
+
+#include <string>
+#include <typeinfo>
+
+#include <benchmark/benchmark.h>
+
+#include "EventDispatcher.hpp"
+#include "EventT.hpp"
+#include "NullPort.hpp"
+
+namespace Snake
+{
+namespace
+{
+
+// Reproduces the try/dynamic_cast/catch cascade Controller::receive used
+// before dispatching by message id, so both strategies can be compared
+// on the same events in one run.
+struct Sink
+{
+    void onTimeout(TimeoutInd const&) { ++handled; }
+    void onDirection(DirectionInd const&) { ++handled; }
+    void onFoodInd(FoodInd const&) { ++handled; }
+    void onFoodResp(FoodResp const&) { ++handled; }
+
+    std::size_t handled = 0;
+};
+
+void cascadeDispatch(Sink& p_sink, Event const& e)
+{
+    try {
+        p_sink.onTimeout(*dynamic_cast<EventT<TimeoutInd> const&>(e));
+    } catch (std::bad_cast&) {
+        try {
+            p_sink.onDirection(*dynamic_cast<EventT<DirectionInd> const&>(e));
+        } catch (std::bad_cast&) {
+            try {
+                p_sink.onFoodInd(*dynamic_cast<EventT<FoodInd> const&>(e));
+            } catch (std::bad_cast&) {
+                p_sink.onFoodResp(*dynamic_cast<EventT<FoodResp> const&>(e));
+            }
+        }
+    }
+}
+
+EventDispatcher<Sink> makeSinkDispatcher()
+{
+    EventDispatcher<Sink> l_dispatcher;
+    l_dispatcher.registerHandler<TimeoutInd, &Sink::onTimeout>();
+    l_dispatcher.registerHandler<DirectionInd, &Sink::onDirection>();
+    l_dispatcher.registerHandler<FoodInd, &Sink::onFoodInd>();
+    l_dispatcher.registerHandler<FoodResp, &Sink::onFoodResp>();
+    return l_dispatcher;
+}
+
+template <class T>
+void BM_CascadeDispatch(benchmark::State& state)
+{
+    Sink l_sink;
+    EventT<T> l_evt;
+    Event const* l_ptr = &l_evt;
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(l_ptr);
+        cascadeDispatch(l_sink, *l_ptr);
+    }
+    benchmark::DoNotOptimize(l_sink.handled);
+}
+
+template <class T>
+void BM_TableDispatch(benchmark::State& state)
+{
+    Sink l_sink;
+    EventT<T> l_evt;
+    Event const* l_ptr = &l_evt;
+    auto const l_dispatcher = makeSinkDispatcher();
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(l_ptr);
+        l_dispatcher.dispatch(l_sink, *l_ptr);
+    }
+    benchmark::DoNotOptimize(l_sink.handled);
+}
+
+BENCHMARK_TEMPLATE(BM_CascadeDispatch, TimeoutInd);
+BENCHMARK_TEMPLATE(BM_CascadeDispatch, DirectionInd);
+BENCHMARK_TEMPLATE(BM_CascadeDispatch, FoodInd);
+BENCHMARK_TEMPLATE(BM_CascadeDispatch, FoodResp);
+BENCHMARK_TEMPLATE(BM_TableDispatch, TimeoutInd);
+BENCHMARK_TEMPLATE(BM_TableDispatch, DirectionInd);
+BENCHMARK_TEMPLATE(BM_TableDispatch, FoodInd);
+BENCHMARK_TEMPLATE(BM_TableDispatch, FoodResp);
+
+struct ControllerFixture
+{
+    NullPort displayPort;
+    NullPort foodPort;
+    NullPort scorePort;
+};
+
+void BM_ControllerReceive_TimeoutInd(benchmark::State& state)
+{
+    constexpr int c_width = 1 << 20;
+    ControllerFixture l_ports;
+    EventT<TimeoutInd> l_timeout;
+    std::string const l_config = "W " + std::to_string(c_width) + " 1 F 0 0 S R 1 1 0";
+
+    auto l_sut = std::make_unique<Controller>(l_ports.displayPort, l_ports.foodPort, l_ports.scorePort, l_config);
+    int l_ticksLeft = c_width - 2;
+
+    for (auto _ : state) {
+        if (not l_ticksLeft--) {
+            state.PauseTiming();
+            l_sut = std::make_unique<Controller>(l_ports.displayPort, l_ports.foodPort, l_ports.scorePort, l_config);
+            l_ticksLeft = c_width - 3;
+            state.ResumeTiming();
+        }
+        l_sut->receive(l_timeout.clone());
+    }
+}
+BENCHMARK(BM_ControllerReceive_TimeoutInd);
+
+void BM_ControllerReceive_DirectionInd(benchmark::State& state)
+{
+    ControllerFixture l_ports;
+    Controller l_sut(l_ports.displayPort, l_ports.foodPort, l_ports.scorePort, "W 100 100 F 50 50 S U 1 20 20");
+    EventT<DirectionInd> l_direction;
+    l_direction->direction = Direction_LEFT;
+
+    for (auto _ : state) {
+        l_sut.receive(l_direction.clone());
+    }
+}
+BENCHMARK(BM_ControllerReceive_DirectionInd);
+
+void BM_ControllerReceive_FoodInd(benchmark::State& state)
+{
+    ControllerFixture l_ports;
+    Controller l_sut(l_ports.displayPort, l_ports.foodPort, l_ports.scorePort, "W 100 100 F 50 50 S U 1 20 20");
+    EventT<FoodInd> l_food;
+    l_food->x = 30;
+    l_food->y = 30;
+
+    for (auto _ : state) {
+        l_sut.receive(l_food.clone());
+    }
+}
+BENCHMARK(BM_ControllerReceive_FoodInd);
+
+void BM_ControllerReceive_FoodResp(benchmark::State& state)
+{
+    ControllerFixture l_ports;
+    Controller l_sut(l_ports.displayPort, l_ports.foodPort, l_ports.scorePort, "W 100 100 F 50 50 S U 1 20 20");
+    EventT<FoodResp> l_food;
+    l_food->x = 30;
+    l_food->y = 30;
+
+    for (auto _ : state) {
+        l_sut.receive(l_food.clone());
+    }
+}
+BENCHMARK(BM_ControllerReceive_FoodResp);
+
+} // namespace
+} // namespace Snake
@@ -0,0 +1,169 @@
+#include "DisplayStream.hpp"
+
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "EventT.hpp"
+#include "NullPort.hpp"
+#include "SnakeController.hpp"
+#include "SnakeWireFormat.hpp"
+
+namespace Snake
+{
+namespace
+{
+
+int const c_mapSize = 64;
+
+// Keeps every batch a controller sends to its display port as one frame.
+struct RecordingDisplayPort : IPort
+{
+    void send(std::unique_ptr<Event> p_evt) override
+    {
+        frames.emplace_back(1, payload<DisplayInd>(*p_evt));
+    }
+
+    void sendBatch(EventBatch p_events) override
+    {
+        frames.emplace_back();
+        for (auto const& l_evt : p_events) {
+            frames.back().push_back(payload<DisplayInd>(*l_evt));
+        }
+    }
+
+    std::vector<std::vector<DisplayInd>> frames;
+};
+
+// A recorded game: the snake mows the whole map row by row, and food is
+// dropped a few cells ahead of it every 32 ticks, so it keeps growing.
+std::vector<std::vector<DisplayInd>> const& recordedGame()
+{
+    static std::vector<std::vector<DisplayInd>> const s_frames = [] {
+        RecordingDisplayPort l_displayPort;
+        NullPort l_foodPort, l_scorePort;
+        std::string l_config = "W " + std::to_string(c_mapSize) + " " + std::to_string(c_mapSize) + " F 0 63 S R 10";
+        for (int x = 9; x >= 0; --x) {
+            l_config += " " + std::to_string(x) + " 0";
+        }
+        Controller l_controller(l_displayPort, l_foodPort, l_scorePort, l_config);
+
+        int x = 9, y = 0, l_step = 1;
+        for (int l_tick = 1; y < c_mapSize - 1 or x + l_step != c_mapSize; ++l_tick) {
+            if (l_tick % 32 == 0 and unsigned(x + 4 * l_step) < unsigned(c_mapSize)) {
+                l_controller.receive(ControllerInput(FoodInd{x + 4 * l_step, y}));
+            }
+            if (unsigned(x + l_step) < unsigned(c_mapSize)) {
+                x += l_step;
+            } else {
+                l_controller.receive(ControllerInput(DirectionInd{Direction_DOWN}));
+                l_controller.receive(ControllerInput(TimeoutInd{}));
+                l_step = -l_step;
+                ++y;
+                l_controller.receive(ControllerInput(DirectionInd{l_step > 0 ? Direction_RIGHT : Direction_LEFT}));
+                continue;
+            }
+            l_controller.receive(ControllerInput(TimeoutInd{}));
+        }
+        return l_displayPort.frames;
+    }();
+
+    return s_frames;
+}
+
+struct BoardHandler : IEventHandler
+{
+    void receive(std::unique_ptr<Event> p_evt) override
+    {
+        DisplayInd const& l_displayInd = payload<DisplayInd>(*p_evt);
+        board[std::size_t(l_displayInd.y) * c_mapSize + l_displayInd.x] = static_cast<std::uint8_t>(l_displayInd.value);
+    }
+
+    std::vector<std::uint8_t> board = std::vector<std::uint8_t>(c_mapSize * c_mapSize);
+};
+
+std::vector<unsigned char> encodeWire(std::vector<std::vector<DisplayInd>> const& p_frames)
+{
+    std::vector<unsigned char> l_stream;
+    for (auto const& l_frame : p_frames) {
+        for (auto const& l_displayInd : l_frame) {
+            WireCodec::encode(EventT<DisplayInd>(l_displayInd), l_stream);
+        }
+    }
+    return l_stream;
+}
+
+std::vector<unsigned char> encodeStream(std::vector<std::vector<DisplayInd>> const& p_frames, unsigned p_keyframeInterval)
+{
+    DisplayStreamEncoder l_encoder(c_mapSize, c_mapSize, p_keyframeInterval);
+    std::vector<unsigned char> l_stream;
+    for (auto const& l_frame : p_frames) {
+        for (auto const& l_displayInd : l_frame) {
+            l_encoder.add(l_displayInd);
+        }
+        l_encoder.finishFrame(l_stream);
+    }
+    return l_stream;
+}
+
+// Baseline: the recorded game as WireCodec records, one per DisplayInd.
+void BM_DisplayWireEncode(benchmark::State& state)
+{
+    auto const& l_frames = recordedGame();
+    std::vector<unsigned char> l_stream;
+
+    for (auto _ : state) {
+        l_stream = encodeWire(l_frames);
+        benchmark::DoNotOptimize(l_stream.data());
+    }
+    state.SetItemsProcessed(state.iterations() * l_frames.size());
+    state.counters["bytesPerFrame"] = double(l_stream.size()) / l_frames.size();
+}
+BENCHMARK(BM_DisplayWireEncode);
+
+// The same game as a display stream; the argument is the keyframe interval.
+void BM_DisplayStreamEncode(benchmark::State& state)
+{
+    auto const& l_frames = recordedGame();
+    std::vector<unsigned char> l_stream;
+
+    for (auto _ : state) {
+        l_stream = encodeStream(l_frames, static_cast<unsigned>(state.range(0)));
+        benchmark::DoNotOptimize(l_stream.data());
+    }
+    state.SetItemsProcessed(state.iterations() * l_frames.size());
+    state.counters["bytesPerFrame"] = double(l_stream.size()) / l_frames.size();
+}
+BENCHMARK(BM_DisplayStreamEncode)->Arg(64)->Arg(256)->Arg(1024);
+
+// What a viewer spends on the game: decoding it onto a board.
+void BM_DisplayWireDecode(benchmark::State& state)
+{
+    auto const& l_frames = recordedGame();
+    std::vector<unsigned char> l_stream = encodeWire(l_frames);
+    BoardHandler l_viewer;
+
+    for (auto _ : state) {
+        WireCodec::decode(l_stream.data(), l_stream.size(), l_viewer);
+        benchmark::DoNotOptimize(l_viewer.board.data());
+    }
+    state.SetItemsProcessed(state.iterations() * l_frames.size());
+}
+BENCHMARK(BM_DisplayWireDecode);
+
+void BM_DisplayStreamDecode(benchmark::State& state)
+{
+    auto const& l_frames = recordedGame();
+    std::vector<unsigned char> const l_stream = encodeStream(l_frames, static_cast<unsigned>(state.range(0)));
+
+    for (auto _ : state) {
+        DisplayStreamDecoder l_viewer;
+        l_viewer.decode(l_stream.data(), l_stream.size());
+        benchmark::DoNotOptimize(&l_viewer);
+    }
+    state.SetItemsProcessed(state.iterations() * l_frames.size());
+}
+BENCHMARK(BM_DisplayStreamDecode)->Arg(64)->Arg(256)->Arg(1024);
+
+} // namespace
+} // namespace Snake
@@ -0,0 +1,116 @@
+#include "SnakeInterface.hpp"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "Event.hpp"
+#include "EventT.hpp"
+
+namespace Snake
+{
+namespace
+{
+
+// Stands for payloads that are not trivially copyable, whose events keep
+// the payload in a heap block of its own.
+struct NamedPayload
+{
+    static constexpr std::uint32_t MESSAGE_ID = 0x7f;
+
+    std::string name = "a name too long for the small string buffer";
+};
+
+template <class T>
+void BM_EventConstruction(benchmark::State& state)
+{
+    for (auto _ : state) {
+        std::unique_ptr<Event> l_evt = std::make_unique<EventT<T>>();
+        benchmark::DoNotOptimize(l_evt.get());
+    }
+}
+
+template <class T>
+void BM_EventClone(benchmark::State& state)
+{
+    EventT<T> l_evt;
+    Event const* l_ptr = &l_evt;
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(l_ptr);
+        auto l_copy = l_ptr->clone();
+        benchmark::DoNotOptimize(l_copy.get());
+    }
+}
+
+template <class T>
+void BM_EventPayload(benchmark::State& state)
+{
+    EventT<T> l_evt;
+    Event const* l_ptr = &l_evt;
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(l_ptr);
+        T const& l_payload = payload<T>(*l_ptr);
+        benchmark::DoNotOptimize(&l_payload);
+    }
+}
+
+// One event handed to p_subscribers sinks, each getting a clone it reads
+// and then drops, as recorders and viewers do with every tick.
+template <class T>
+void BM_EventFanOut(benchmark::State& state)
+{
+    std::size_t const l_subscribers = static_cast<std::size_t>(state.range(0));
+    std::vector<std::unique_ptr<Event>> l_sinks(l_subscribers);
+
+    for (auto _ : state) {
+        EventT<T> l_evt;
+        for (auto& l_sink : l_sinks) {
+            l_sink = l_evt.clone();
+            benchmark::DoNotOptimize(&payload<T>(static_cast<Event const&>(*l_sink)));
+        }
+        for (auto& l_sink : l_sinks) {
+            l_sink.reset();
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// The same fan-out copying the payload into every clone, as clone() used to.
+template <class T>
+void BM_EventFanOutDeepCopy(benchmark::State& state)
+{
+    std::size_t const l_subscribers = static_cast<std::size_t>(state.range(0));
+    std::vector<std::unique_ptr<Event>> l_sinks(l_subscribers);
+
+    for (auto _ : state) {
+        EventT<T> l_evt;
+        for (auto& l_sink : l_sinks) {
+            l_sink = std::make_unique<EventT<T>>(*static_cast<EventT<T> const&>(l_evt));
+            benchmark::DoNotOptimize(&payload<T>(static_cast<Event const&>(*l_sink)));
+        }
+        for (auto& l_sink : l_sinks) {
+            l_sink.reset();
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK_TEMPLATE(BM_EventConstruction, TimeoutInd);
+BENCHMARK_TEMPLATE(BM_EventConstruction, DisplayInd);
+BENCHMARK_TEMPLATE(BM_EventConstruction, NamedPayload);
+BENCHMARK_TEMPLATE(BM_EventClone, TimeoutInd);
+BENCHMARK_TEMPLATE(BM_EventClone, DisplayInd);
+BENCHMARK_TEMPLATE(BM_EventClone, NamedPayload);
+BENCHMARK_TEMPLATE(BM_EventPayload, TimeoutInd);
+BENCHMARK_TEMPLATE(BM_EventPayload, DisplayInd);
+BENCHMARK_TEMPLATE(BM_EventPayload, NamedPayload);
+BENCHMARK_TEMPLATE(BM_EventFanOut, DisplayInd)->Arg(1)->Arg(8)->Arg(64);
+BENCHMARK_TEMPLATE(BM_EventFanOut, NamedPayload)->Arg(1)->Arg(8)->Arg(64);
+BENCHMARK_TEMPLATE(BM_EventFanOutDeepCopy, NamedPayload)->Arg(1)->Arg(8)->Arg(64);
+
+} // namespace
+} // namespace Snake
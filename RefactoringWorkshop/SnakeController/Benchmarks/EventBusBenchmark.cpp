@@ -0,0 +1,103 @@
+#include "EventBus.hpp"
+
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "EventT.hpp"
+#include "NullPort.hpp"
+#include "SnakeInterface.hpp"
+
+namespace Snake
+{
+namespace
+{
+
+struct DisplayCounter
+{
+    void onDisplay(DisplayInd const& p_displayInd) { cells += p_displayInd.value; }
+
+    long cells = 0;
+};
+
+// Hand written fan-out: an IPort cloning every event to a list of ports.
+class ForwardingPort : public IPort
+{
+public:
+    explicit ForwardingPort(std::vector<IPort*> p_targets)
+        : m_targets(std::move(p_targets))
+    {}
+
+    void send(std::unique_ptr<Event> p_evt) override
+    {
+        for (IPort* l_target : m_targets) {
+            l_target->send(p_evt->clone());
+        }
+    }
+
+private:
+    std::vector<IPort*> m_targets;
+};
+
+// DisplayInd published to N member function subscribers, with a ScoreInd
+// subscriber on the side that is never called.
+void BM_EventBusPublish(benchmark::State& state)
+{
+    std::vector<DisplayCounter> l_subscribers(static_cast<std::size_t>(state.range(0)));
+    NullPort l_scores;
+    EventBus l_bus;
+    l_bus.subscribe(ScoreInd::MESSAGE_ID, l_scores);
+    for (auto& l_subscriber : l_subscribers) {
+        l_bus.subscribe<DisplayInd, DisplayCounter, &DisplayCounter::onDisplay>(l_subscriber);
+    }
+
+    EventT<DisplayInd> const l_evt(DisplayInd{1, 2, Cell_SNAKE});
+    Event const* l_ptr = &l_evt;
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(l_ptr);
+        benchmark::DoNotOptimize(l_bus.publish(*l_ptr));
+    }
+    state.SetItemsProcessed(state.iterations());
+    state.counters["deliveries"] = benchmark::Counter(double(state.iterations() * state.range(0)),
+                                                      benchmark::Counter::kIsRate);
+}
+BENCHMARK(BM_EventBusPublish)->Arg(1)->Arg(4)->Arg(16);
+
+// Owning events sent through the bus as a port, as a controller does.
+void BM_EventBusSend(benchmark::State& state)
+{
+    std::vector<DisplayCounter> l_subscribers(static_cast<std::size_t>(state.range(0)));
+    EventBus l_bus;
+    for (auto& l_subscriber : l_subscribers) {
+        l_bus.subscribe<DisplayInd, DisplayCounter, &DisplayCounter::onDisplay>(l_subscriber);
+    }
+    IPort& l_port = l_bus;
+
+    for (auto _ : state) {
+        l_port.send(std::make_unique<EventT<DisplayInd>>(DisplayInd{1, 2, Cell_SNAKE}));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_EventBusSend)->Arg(1)->Arg(4)->Arg(16);
+
+// Baseline: the same fan-out through a forwarding port and IPort sinks.
+void BM_ForwardingPortSend(benchmark::State& state)
+{
+    std::vector<NullPort> l_sinks(static_cast<std::size_t>(state.range(0)));
+    std::vector<IPort*> l_targets;
+    for (auto& l_sink : l_sinks) {
+        l_targets.push_back(&l_sink);
+    }
+    ForwardingPort l_forwarder(l_targets);
+    IPort& l_port = l_forwarder;
+
+    for (auto _ : state) {
+        l_port.send(std::make_unique<EventT<DisplayInd>>(DisplayInd{1, 2, Cell_SNAKE}));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_ForwardingPortSend)->Arg(1)->Arg(4)->Arg(16);
+
+} // namespace
+} // namespace Snake
@@ -0,0 +1,53 @@
+#include "AsyncSessionHost.hpp"
+#include "EventLoop.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include "NullPort.hpp"
+
+namespace Snake
+{
+namespace
+{
+
+// Scheduling latency of an EventLoop running the given number of sessions
+// in real time, each ticked every 10 ms and waiting 5 ms for every food
+// response. Every snake eats the food four cells ahead of it, so each
+// session waits on one food response while the others keep ticking.
+void BM_AsyncSessionsSchedulingLatency(benchmark::State& state)
+{
+    std::size_t const l_sessions = static_cast<std::size_t>(state.range(0));
+
+    EventLoop l_loop;
+    AsyncSessionHost l_host(l_loop, std::chrono::milliseconds(10), std::chrono::milliseconds(5));
+    NullPort l_displayPort, l_scorePort;
+    for (std::size_t i = 0; i < l_sessions; ++i) {
+        int const y = static_cast<int>(i % 32);
+        l_host.createSession(l_displayPort, l_scorePort,
+                             "W 32 32 F 6 " + std::to_string(y) + " S R 3 2 " + std::to_string(y)
+                             + " 1 " + std::to_string(y) + " 0 " + std::to_string(y));
+    }
+
+    for (auto _ : state) {
+        l_loop.runUntil(EventLoop::Clock::now() + std::chrono::milliseconds(500));
+    }
+
+    LatencyHistogram const& l_latency = l_loop.schedulingLatency();
+    state.SetItemsProcessed(static_cast<std::int64_t>(l_host.stats().ticks));
+    state.counters["p50_us"] = l_latency.percentile(50) / 1e3;
+    state.counters["p99_us"] = l_latency.percentile(99) / 1e3;
+    state.counters["max_us"] = l_latency.max() / 1e3;
+    state.counters["foodResponses"] = static_cast<double>(l_host.stats().foodResponses);
+    state.counters["errors"] = static_cast<double>(l_host.stats().errors);
+}
+BENCHMARK(BM_AsyncSessionsSchedulingLatency)
+    ->ArgNames({"sessions"})
+    ->Arg(100)
+    ->Arg(1000)
+    ->Arg(10000)
+    ->Iterations(1)
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+
+} // namespace
+} // namespace Snake
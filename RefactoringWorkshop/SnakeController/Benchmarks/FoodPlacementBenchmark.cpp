@@ -0,0 +1,85 @@
+#include "SnakeController.hpp"
+
+#include <random>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "EventT.hpp"
+#include "NullPort.hpp"
+
+namespace Snake
+{
+namespace
+{
+
+constexpr int c_side = 64;
+
+// Snake winding row by row over p_fillPercent of a 64x64 map.
+std::string windingSnakeConfig(int p_fillPercent)
+{
+    int const l_length = c_side * c_side * p_fillPercent / 100;
+
+    std::vector<std::string> l_cells;
+    for (int i = 0; i < l_length; ++i) {
+        int const y = i / c_side;
+        int const x = (y % 2) ? c_side - 1 - i % c_side : i % c_side;
+        l_cells.push_back(std::to_string(x) + " " + std::to_string(y));
+    }
+
+    std::string l_config = "W " + std::to_string(c_side) + " " + std::to_string(c_side)
+        + " F 0 " + std::to_string(c_side - 1) + " S D " + std::to_string(l_length);
+    for (auto l_cell = l_cells.rbegin(); l_cell != l_cells.rend(); ++l_cell) {
+        l_config += " " + *l_cell;
+    }
+    return l_config;
+}
+
+// One placement: a FoodResp at a random cell, answered with another one
+// for as long as the controller keeps sending FoodReq. roundTrips counts
+// the FoodResp each placement took; over a network every extra one is a
+// full round trip on top of the time measured here.
+void BM_FoodPlacementByRetry(benchmark::State& state)
+{
+    NullPort l_displayPort, l_foodPort, l_scorePort;
+    Controller l_controller(l_displayPort, l_foodPort, l_scorePort, windingSnakeConfig(static_cast<int>(state.range(0))));
+    std::minstd_rand l_random(1);
+    std::uniform_int_distribution<int> l_coordinate(0, c_side - 1);
+    std::size_t l_roundTrips = 0;
+
+    for (auto _ : state) {
+        std::size_t l_requests;
+        do {
+            l_requests = l_foodPort.sent();
+            ++l_roundTrips;
+            l_controller.receive(std::make_unique<EventT<FoodResp>>(FoodResp{l_coordinate(l_random), l_coordinate(l_random)}));
+        } while (l_foodPort.sent() != l_requests);
+    }
+
+    state.counters["roundTrips"] = benchmark::Counter(static_cast<double>(l_roundTrips), benchmark::Counter::kAvgIterations);
+}
+BENCHMARK(BM_FoodPlacementByRetry)->ArgNames({"fill%"})->Arg(10)->Arg(50)->Arg(95);
+
+// The same placement with relocateCollidingFood(): always one FoodResp.
+void BM_FoodPlacementByFreeCellIndex(benchmark::State& state)
+{
+    NullPort l_displayPort, l_foodPort, l_scorePort;
+    Controller l_controller(l_displayPort, l_foodPort, l_scorePort, windingSnakeConfig(static_cast<int>(state.range(0))));
+    l_controller.relocateCollidingFood();
+    std::minstd_rand l_random(1);
+    std::uniform_int_distribution<int> l_coordinate(0, c_side - 1);
+
+    for (auto _ : state) {
+        l_controller.receive(std::make_unique<EventT<FoodResp>>(FoodResp{l_coordinate(l_random), l_coordinate(l_random)}));
+    }
+
+    state.counters["roundTrips"] = benchmark::Counter(1);
+    if (l_foodPort.sent()) {
+        state.SkipWithError("controller requested food again");
+    }
+}
+BENCHMARK(BM_FoodPlacementByFreeCellIndex)->ArgNames({"fill%"})->Arg(10)->Arg(50)->Arg(95);
+
+} // namespace
+} // namespace Snake
@@ -0,0 +1,60 @@
+#include "FramebufferPort.hpp"
+
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "EventT.hpp"
+
+namespace Snake
+{
+namespace
+{
+
+// One tick of a snake of length 64 crawling along the rows of the board:
+// the head and the freed tail cell are drawn, the tick ends and a viewer
+// copies the dirty rectangles.
+void BM_FramebufferTick(benchmark::State& state)
+{
+    int const l_side = static_cast<int>(state.range(0));
+    FramebufferPort l_framebuffer(l_side, l_side);
+    std::unique_ptr<Event> l_batch[2];
+    std::vector<std::uint8_t> l_viewer;
+    std::size_t l_cell = 0;
+    std::size_t const l_cells = std::size_t(l_side) * std::size_t(l_side);
+
+    for (auto _ : state) {
+        std::size_t const l_head = (l_cell + 64) % l_cells;
+        l_batch[0] = std::make_unique<EventT<DisplayInd>>(DisplayInd{int(l_cell % l_side), int(l_cell / l_side), Cell_FREE});
+        l_batch[1] = std::make_unique<EventT<DisplayInd>>(DisplayInd{int(l_head % l_side), int(l_head / l_side), Cell_SNAKE});
+        l_framebuffer.sendBatch(EventBatch{l_batch, 2});
+        l_framebuffer.endTick();
+
+        l_viewer.clear();
+        for (FrameRect const& l_rect : l_framebuffer.dirtyRects()) {
+            l_framebuffer.copyRect(l_rect, l_viewer);
+        }
+        benchmark::DoNotOptimize(l_viewer.data());
+        l_cell = (l_cell + 1) % l_cells;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_FramebufferTick)->ArgNames({"side"})->Arg(64)->Arg(1024)->Arg(4096);
+
+// What a viewer joining mid-game costs: a copy of the stored board.
+void BM_FramebufferFullFrame(benchmark::State& state)
+{
+    int const l_side = static_cast<int>(state.range(0));
+    FramebufferPort l_framebuffer(l_side, l_side);
+    std::vector<std::uint64_t> l_frame;
+
+    for (auto _ : state) {
+        l_frame = l_framebuffer.frame();
+        benchmark::DoNotOptimize(l_frame.data());
+    }
+    state.SetBytesProcessed(state.iterations() * std::int64_t(l_framebuffer.frame().size() * sizeof(std::uint64_t)));
+}
+BENCHMARK(BM_FramebufferFullFrame)->ArgNames({"side"})->Arg(64)->Arg(1024)->Arg(4096);
+
+} // namespace
+} // namespace Snake
@@ -0,0 +1,74 @@
+#include "SnakeController.hpp"
+
+#include <cstdio>
+#include <string>
+
+#include <benchmark/benchmark.h>
+
+#include "EventJournal.hpp"
+#include "EventPool.hpp"
+#include "EventT.hpp"
+#include "JournalReplayer.hpp"
+#include "NullPort.hpp"
+#include "SnakeWireFormat.hpp"
+
+namespace Snake
+{
+namespace
+{
+
+constexpr char c_config[] = "W 10 10 F 9 9 S R 1 4 4";
+
+// Records p_ticks ticks of a snake circling a 2x2 square: every tick is a
+// turn to the right followed by a timeout.
+void recordSession(std::string const& p_path, std::size_t p_ticks)
+{
+    Direction const l_turns[] = {Direction_DOWN, Direction_LEFT, Direction_UP, Direction_RIGHT};
+
+    JournalWriter<WireCodec> l_journal(p_path);
+    NullPort l_display, l_food, l_score;
+    RecordingPort<WireCodec> l_recordedDisplay(l_journal, 1, l_display);
+    RecordingPort<WireCodec> l_recordedFood(l_journal, 2, l_food);
+    RecordingPort<WireCodec> l_recordedScore(l_journal, 3, l_score);
+    Controller l_controller(l_recordedDisplay, l_recordedFood, l_recordedScore, c_config);
+    RecordingEventHandler<WireCodec> l_handler(l_journal, l_controller);
+
+    for (std::size_t i = 0; i < p_ticks; ++i) {
+        l_handler.receive(std::make_unique<EventT<DirectionInd>>(DirectionInd{l_turns[i % 4]}));
+        l_handler.receive(std::make_unique<EventT<TimeoutInd>>());
+    }
+}
+
+// One iteration replays the whole journal into a fresh controller, with
+// every output checked against the recording when state.range(1) is set.
+void BM_JournalReplay(benchmark::State& state)
+{
+    std::string const l_path = "JournalReplayBenchmark.journal";
+    recordSession(l_path, static_cast<std::size_t>(state.range(0)));
+    bool const l_verify = state.range(1) != 0;
+
+    JournalReplayer<WireCodec> l_replayer(l_path);
+    ReplayStats l_stats;
+    resetEventPoolStats();
+
+    for (auto _ : state) {
+        NullPort l_display, l_food, l_score;
+        Controller l_controller(l_verify ? l_replayer.port(1) : l_display,
+                                l_verify ? l_replayer.port(2) : l_food,
+                                l_verify ? l_replayer.port(3) : l_score,
+                                c_config);
+        l_stats = l_replayer.replay(l_controller, l_verify);
+    }
+
+    state.SetItemsProcessed(state.iterations() * l_stats.inputs);
+    state.counters["mismatches"] = static_cast<double>(l_stats.mismatches);
+    state.counters["heapAllocations"] = static_cast<double>(eventPoolStats().heapAllocations);
+    std::remove(l_path.c_str());
+}
+BENCHMARK(BM_JournalReplay)
+    ->ArgNames({"ticks", "verify"})
+    ->Args({100000, 0})
+    ->Args({100000, 1});
+
+} // namespace
+} // namespace Snake
@@ -0,0 +1,23 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+
+#include "Event.hpp"
+#include "IPort.hpp"
+
+namespace Snake
+{
+
+class NullPort : public IPort
+{
+public:
+    void send(std::unique_ptr<Event>) override { ++m_sent; }
+
+    std::size_t sent() const { return m_sent; }
+
+private:
+    std::size_t m_sent = 0;
+};
+
+} // namespace Snake
@@ -0,0 +1,85 @@
+#include "SnakeController.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include "BenchmarkConfigs.hpp"
+#include "EventT.hpp"
+#include "NullPort.hpp"
+
+namespace Snake
+{
+namespace
+{
+
+// Tick cost as a function of snake length. The snake is rebuilt outside
+// of the timed region whenever it is about to reach the wall.
+void BM_TickBySnakeLength(benchmark::State& state)
+{
+    int const l_length = static_cast<int>(state.range(0));
+    int const l_room = 1 << 16;
+    std::string const l_config = straightSnakeConfig(l_length, l_room);
+
+    NullPort l_displayPort, l_foodPort, l_scorePort;
+    EventT<TimeoutInd> l_timeout;
+    std::unique_ptr<Controller> l_sut;
+    int l_ticksLeft = 0;
+
+    for (auto _ : state) {
+        if (not l_ticksLeft--) {
+            state.PauseTiming();
+            l_sut = std::make_unique<Controller>(l_displayPort, l_foodPort, l_scorePort, l_config);
+            l_ticksLeft = l_room - 2;
+            state.ResumeTiming();
+        }
+        l_sut->receive(l_timeout.clone());
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_TickBySnakeLength)->RangeMultiplier(10)->Range(10, 100000);
+
+// Tick cost of a length 10 snake as a function of the map height; the
+// map is (10 + 4096) cells wide. Occupancy is a bitmap over the whole
+// map, so this shows whether the map size leaks into the tick.
+void BM_TickByMapSize(benchmark::State& state)
+{
+    int const l_room = 1 << 12;
+    std::string const l_config = straightSnakeConfig(10, l_room, static_cast<int>(state.range(0)));
+
+    NullPort l_displayPort, l_foodPort, l_scorePort;
+    EventT<TimeoutInd> l_timeout;
+    std::unique_ptr<Controller> l_sut;
+    int l_ticksLeft = 0;
+
+    for (auto _ : state) {
+        if (not l_ticksLeft--) {
+            state.PauseTiming();
+            l_sut = std::make_unique<Controller>(l_displayPort, l_foodPort, l_scorePort, l_config);
+            l_ticksLeft = l_room - 2;
+            state.ResumeTiming();
+        }
+        l_sut->receive(l_timeout.clone());
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_TickByMapSize)->RangeMultiplier(16)->Range(2, 8192);
+
+// Food placement checks, alternating a free cell and a cell on the body.
+void BM_FoodRespBySnakeLength(benchmark::State& state)
+{
+    int const l_length = static_cast<int>(state.range(0));
+    NullPort l_displayPort, l_foodPort, l_scorePort;
+    Controller l_sut(l_displayPort, l_foodPort, l_scorePort, straightSnakeConfig(l_length, 2));
+
+    EventT<FoodResp> l_onFreeCell(FoodResp{l_length / 2, 1});
+    EventT<FoodResp> l_onBody(FoodResp{0, 0});
+
+    for (auto _ : state) {
+        l_sut.receive(l_onFreeCell.clone());
+        l_sut.receive(l_onBody.clone());
+    }
+    state.SetItemsProcessed(2 * state.iterations());
+}
+BENCHMARK(BM_FoodRespBySnakeLength)->RangeMultiplier(10)->Range(10, 100000);
+
+} // namespace
+} // namespace Snake
@@ -0,0 +1,111 @@
+#include "Pathfinder.hpp"
+
+#include <random>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+namespace Snake
+{
+namespace
+{
+
+// Square map with a fifth of the cells taken, at random.
+OccupancyGrid randomBoard(int p_side)
+{
+    std::minstd_rand l_random(5);
+    OccupancyGrid l_board(p_side, p_side);
+    for (int y = 0; y < p_side; ++y) {
+        for (int x = 0; x < p_side; ++x) {
+            if (std::uniform_int_distribution<int>(0, 4)(l_random) == 0) {
+                l_board.set(x, y);
+            }
+        }
+    }
+    l_board.reset(p_side / 2, p_side / 2);
+    return l_board;
+}
+
+// The textbook search the bots would otherwise run: a cell at a time,
+// with a preallocated queue.
+void BM_DistanceFieldByQueue(benchmark::State& state)
+{
+    int const l_side = static_cast<int>(state.range(0));
+    OccupancyGrid const l_board = randomBoard(l_side);
+    std::vector<std::uint32_t> l_distance;
+    std::vector<int> l_queue(std::size_t(l_side) * std::size_t(l_side));
+
+    for (auto _ : state) {
+        l_distance.assign(l_queue.size(), DistanceField::unreachable);
+        std::size_t l_head = 0, l_tail = 0;
+        int const l_target = l_side / 2 * l_side + l_side / 2;
+        l_distance[std::size_t(l_target)] = 0;
+        l_queue[l_tail++] = l_target;
+
+        while (l_head != l_tail) {
+            int const l_cell = l_queue[l_head++];
+            int const x = l_cell % l_side, y = l_cell / l_side;
+            int const l_moves[4][2] = {{1, 0}, {-1, 0}, {0, 1}, {0, -1}};
+            for (auto const& l_move : l_moves) {
+                int const l_x = x + l_move[0], l_y = y + l_move[1];
+                int const l_next = l_y * l_side + l_x;
+                if (l_board.contains(l_x, l_y) and not l_board.test(l_x, l_y) and
+                    l_distance[std::size_t(l_next)] == DistanceField::unreachable) {
+                    l_distance[std::size_t(l_next)] = l_distance[std::size_t(l_cell)] + 1;
+                    l_queue[l_tail++] = l_next;
+                }
+            }
+        }
+        benchmark::DoNotOptimize(l_distance.data());
+    }
+    state.SetItemsProcessed(state.iterations() * l_side * l_side);
+}
+BENCHMARK(BM_DistanceFieldByQueue)->ArgNames({"side"})->Arg(16)->Arg(64)->Arg(256)->Arg(1024);
+
+// DistanceField, searching by bitboard up to side 64 and by queue above.
+void BM_DistanceField(benchmark::State& state)
+{
+    int const l_side = static_cast<int>(state.range(0));
+    OccupancyGrid const l_board = randomBoard(l_side);
+    DistanceField l_field;
+
+    for (auto _ : state) {
+        l_field.compute(l_board, l_side / 2, l_side / 2);
+        benchmark::DoNotOptimize(&l_field);
+    }
+    state.SetItemsProcessed(state.iterations() * l_side * l_side);
+}
+BENCHMARK(BM_DistanceField)->ArgNames({"side"})->Arg(16)->Arg(64)->Arg(256)->Arg(1024);
+
+// One tick of a map with several bots: the board changes, the distance
+// field from the food is computed once, then every bot picks its move.
+// Items are decisions.
+void BM_BotDecisionsPerTick(benchmark::State& state)
+{
+    int const l_side = static_cast<int>(state.range(0));
+    int const l_bots = static_cast<int>(state.range(1));
+    OccupancyGrid l_board = randomBoard(l_side);
+    Pathfinder l_pathfinder;
+    int l_tick = 0;
+
+    for (auto _ : state) {
+        int const l_cell = l_tick++ % l_side;
+        l_board.test(l_cell, 0) ? l_board.reset(l_cell, 0) : l_board.set(l_cell, 0);
+
+        DistanceField const& l_field = l_pathfinder.field(l_board, {l_side / 2, l_side / 2});
+        for (int l_bot = 0; l_bot < l_bots; ++l_bot) {
+            benchmark::DoNotOptimize(
+                Pathfinder::nextDirection(l_field, l_board, {l_bot % l_side, l_side - 1}, Direction_UP));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * l_bots);
+}
+BENCHMARK(BM_BotDecisionsPerTick)
+    ->ArgNames({"side", "bots"})
+    ->Args({64, 1})
+    ->Args({64, 16})
+    ->Args({256, 1})
+    ->Args({256, 16});
+
+} // namespace
+} // namespace Snake
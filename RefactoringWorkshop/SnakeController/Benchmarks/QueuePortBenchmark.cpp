@@ -0,0 +1,102 @@
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "EventT.hpp"
+#include "QueuePort.hpp"
+#include "SnakeInterface.hpp"
+
+namespace Snake
+{
+namespace
+{
+
+constexpr std::size_t c_eventsPerIteration = 1 << 16;
+
+struct CountingHandler : IEventHandler
+{
+    void receive(std::unique_ptr<Event>) override { ++received; }
+
+    std::size_t received = 0;
+};
+
+// What cross-thread delivery looks like without QueuePort: a deque
+// guarded by one mutex shared by every producer and the consumer.
+class MutexQueuePort : public IPort
+{
+public:
+    void send(std::unique_ptr<Event> p_evt) override
+    {
+        std::lock_guard<std::mutex> l_lock(m_mutex);
+        m_events.push_back(std::move(p_evt));
+    }
+
+    std::size_t drain(IEventHandler& p_handler)
+    {
+        std::deque<std::unique_ptr<Event>> l_events;
+        {
+            std::lock_guard<std::mutex> l_lock(m_mutex);
+            l_events.swap(m_events);
+        }
+        for (auto& l_evt : l_events) {
+            p_handler.receive(std::move(l_evt));
+        }
+        return l_events.size();
+    }
+
+private:
+    std::mutex m_mutex;
+    std::deque<std::unique_ptr<Event>> m_events;
+};
+
+// Every iteration, state.range(0) producer threads post
+// c_eventsPerIteration DirectionInds in total while the benchmark thread
+// drains them into a handler.
+template <class Port>
+void runContention(benchmark::State& state, Port& p_port)
+{
+    std::size_t const l_producers = static_cast<std::size_t>(state.range(0));
+    std::size_t const l_perProducer = c_eventsPerIteration / l_producers;
+
+    for (auto _ : state) {
+        CountingHandler l_handler;
+        std::vector<std::thread> l_threads;
+        for (std::size_t p = 0; p < l_producers; ++p) {
+            l_threads.emplace_back([&p_port, l_perProducer] {
+                for (std::size_t i = 0; i < l_perProducer; ++i) {
+                    p_port.send(std::make_unique<EventT<DirectionInd>>(DirectionInd{Direction_UP}));
+                }
+            });
+        }
+        while (l_handler.received < l_perProducer * l_producers) {
+            if (not p_port.drain(l_handler)) {
+                std::this_thread::yield();
+            }
+        }
+        for (auto& l_thread : l_threads) {
+            l_thread.join();
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * l_perProducer * l_producers);
+}
+
+void BM_QueuePortContention(benchmark::State& state)
+{
+    QueuePort l_port(1024);
+    runContention(state, l_port);
+}
+BENCHMARK(BM_QueuePortContention)->ArgName("producers")->Arg(1)->Arg(4)->Arg(16)->UseRealTime();
+
+void BM_MutexQueueContention(benchmark::State& state)
+{
+    MutexQueuePort l_port;
+    runContention(state, l_port);
+}
+BENCHMARK(BM_MutexQueueContention)->ArgName("producers")->Arg(1)->Arg(4)->Arg(16)->UseRealTime();
+
+} // namespace
+} // namespace Snake
@@ -0,0 +1,53 @@
+#include "SessionManager.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include "EventT.hpp"
+#include "NullPort.hpp"
+#include "SnakeInterface.hpp"
+
+namespace Snake
+{
+namespace
+{
+
+// One iteration turns every snake and ticks every session once. Snakes
+// of length 1 turning right on every tick circle a 2x2 square forever,
+// so the workload does not drift towards LooseInd handling.
+void BM_SessionManagerTick(benchmark::State& state)
+{
+    std::size_t const l_shards = static_cast<std::size_t>(state.range(0));
+    std::size_t const l_sessions = static_cast<std::size_t>(state.range(1));
+    Direction const l_turns[] = {Direction_DOWN, Direction_LEFT, Direction_UP, Direction_RIGHT};
+
+    SessionManager l_manager(l_shards);
+    std::vector<NullPort> l_ports(3 * l_sessions);
+    for (std::size_t i = 0; i < l_sessions; ++i) {
+        l_manager.createSession(l_ports[3 * i], l_ports[3 * i + 1], l_ports[3 * i + 2], "W 10 10 F 9 9 S R 1 4 4");
+    }
+    l_manager.waitIdle();
+
+    std::size_t l_turn = 0;
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < l_sessions; ++i) {
+            l_manager.post(i, std::make_unique<EventT<DirectionInd>>(DirectionInd{l_turns[l_turn]}));
+        }
+        l_manager.tick();
+        l_manager.waitIdle();
+        l_turn = (l_turn + 1) % 4;
+    }
+
+    auto const l_stats = l_manager.stats();
+    state.SetItemsProcessed(l_stats.ticks);
+    state.counters["errors"] = static_cast<double>(l_stats.errors);
+}
+BENCHMARK(BM_SessionManagerTick)
+    ->ArgNames({"shards", "sessions"})
+    ->Args({1, 10000})
+    ->Args({2, 10000})
+    ->Args({4, 10000})
+    ->Args({8, 10000})
+    ->UseRealTime();
+
+} // namespace
+} // namespace Snake
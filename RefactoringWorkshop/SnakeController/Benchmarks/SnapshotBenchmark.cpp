@@ -0,0 +1,46 @@
+#include "SnakeController.hpp"
+
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "BenchmarkConfigs.hpp"
+#include "NullPort.hpp"
+
+namespace Snake
+{
+namespace
+{
+
+void BM_Snapshot(benchmark::State& state)
+{
+    NullPort l_display, l_food, l_score;
+    Controller l_sut(l_display, l_food, l_score, straightSnakeConfig(static_cast<int>(state.range(0)), 10));
+    std::vector<unsigned char> l_snapshot;
+
+    for (auto _ : state) {
+        l_snapshot.clear();
+        l_sut.snapshot(l_snapshot);
+        benchmark::DoNotOptimize(l_snapshot.data());
+    }
+    state.SetBytesProcessed(state.iterations() * l_snapshot.size());
+}
+BENCHMARK(BM_Snapshot)->RangeMultiplier(100)->Range(10, 100000);
+
+void BM_Restore(benchmark::State& state)
+{
+    NullPort l_display, l_food, l_score;
+    Controller l_source(l_display, l_food, l_score, straightSnakeConfig(static_cast<int>(state.range(0)), 10));
+    std::vector<unsigned char> l_snapshot;
+    l_source.snapshot(l_snapshot);
+
+    for (auto _ : state) {
+        Controller l_sut(l_display, l_food, l_score, ControllerSnapshot{l_snapshot.data(), l_snapshot.size()});
+        benchmark::DoNotOptimize(&l_sut);
+    }
+    state.SetBytesProcessed(state.iterations() * l_snapshot.size());
+}
+BENCHMARK(BM_Restore)->RangeMultiplier(100)->Range(10, 100000);
+
+} // namespace
+} // namespace Snake
@@ -0,0 +1,54 @@
+#include "SnakeController.hpp"
+
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "BenchmarkConfigs.hpp"
+#include "ConfigReader.hpp"
+#include "NullPort.hpp"
+
+namespace Snake
+{
+namespace
+{
+
+constexpr std::size_t c_controllers = 100000;
+
+// One iteration constructs c_controllers controllers from a config with a
+// snake of state.range(0) segments, as a bulk session start would.
+void BM_CreateControllers(benchmark::State& state)
+{
+    std::string const l_config = straightSnakeConfig(static_cast<int>(state.range(0)), 10);
+    NullPort l_display, l_food, l_score;
+    std::vector<std::unique_ptr<Controller>> l_controllers(c_controllers);
+
+    for (auto _ : state) {
+        for (auto& l_controller : l_controllers) {
+            l_controller = std::make_unique<Controller>(l_display, l_food, l_score, l_config);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * c_controllers);
+}
+BENCHMARK(BM_CreateControllers)->Arg(1)->Arg(100)->Unit(benchmark::kMillisecond);
+
+void BM_CreateControllersFromBinary(benchmark::State& state)
+{
+    std::vector<unsigned char> l_config;
+    encodeBinaryConfig(straightSnakeConfig(static_cast<int>(state.range(0)), 10), l_config);
+    NullPort l_display, l_food, l_score;
+    std::vector<std::unique_ptr<Controller>> l_controllers(c_controllers);
+
+    for (auto _ : state) {
+        for (auto& l_controller : l_controllers) {
+            l_controller = std::make_unique<Controller>(
+                l_display, l_food, l_score, BinaryConfig{l_config.data(), l_config.size()});
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * c_controllers);
+}
+BENCHMARK(BM_CreateControllersFromBinary)->Arg(1)->Arg(100)->Unit(benchmark::kMillisecond);
+
+} // namespace
+} // namespace Snake
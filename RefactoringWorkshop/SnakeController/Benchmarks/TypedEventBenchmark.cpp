@@ -0,0 +1,94 @@
+#include "SnakeController.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include "EventT.hpp"
+#include "NullPort.hpp"
+#include "TypedEvent.hpp"
+
+namespace Snake
+{
+namespace
+{
+
+// The same inputs delivered to Controller as heap-allocated EventT objects
+// through IEventHandler and as ControllerInput values through
+// ITypedEventHandler. DirectionInd and FoodInd (with the food landing on
+// the snake) do little work of their own, so the delivery dominates.
+struct Ports
+{
+    NullPort display;
+    NullPort food;
+    NullPort score;
+};
+
+constexpr char c_config[] = "W 100 100 F 50 50 S U 1 20 20";
+
+template <class T>
+T input();
+
+template <>
+DirectionInd input<DirectionInd>() { return DirectionInd{Direction_LEFT}; }
+
+template <>
+FoodInd input<FoodInd>() { return FoodInd{20, 20}; }
+
+template <class T>
+void BM_VirtualReceive(benchmark::State& state)
+{
+    Ports l_ports;
+    Controller l_sut(l_ports.display, l_ports.food, l_ports.score, c_config);
+    IEventHandler& l_handler = l_sut;
+    T const l_payload = input<T>();
+
+    for (auto _ : state) {
+        l_handler.receive(std::make_unique<EventT<T>>(l_payload));
+    }
+}
+
+template <class T>
+void BM_TypedReceive(benchmark::State& state)
+{
+    Ports l_ports;
+    Controller l_sut(l_ports.display, l_ports.food, l_ports.score, c_config);
+    ITypedEventHandler<TimeoutInd, DirectionInd, FoodInd, FoodResp>& l_handler = l_sut;
+    T const l_payload = input<T>();
+
+    for (auto _ : state) {
+        l_handler.receive(ControllerInput(l_payload));
+    }
+}
+
+BENCHMARK_TEMPLATE(BM_VirtualReceive, DirectionInd);
+BENCHMARK_TEMPLATE(BM_TypedReceive, DirectionInd);
+BENCHMARK_TEMPLATE(BM_VirtualReceive, FoodInd);
+BENCHMARK_TEMPLATE(BM_TypedReceive, FoodInd);
+
+// Reading the payload back: dynamic_cast in payload<T>() against the
+// index check of TypedEvent::get<T>().
+void BM_VirtualPayloadAccess(benchmark::State& state)
+{
+    EventT<FoodInd> l_evt(FoodInd{1, 2});
+    Event const* l_ptr = &l_evt;
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(l_ptr);
+        benchmark::DoNotOptimize(payload<FoodInd>(*l_ptr).x);
+    }
+}
+BENCHMARK(BM_VirtualPayloadAccess);
+
+void BM_TypedPayloadAccess(benchmark::State& state)
+{
+    ControllerInput l_evt(FoodInd{1, 2});
+    ControllerInput const* l_ptr = &l_evt;
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(l_ptr);
+        benchmark::DoNotOptimize(l_ptr->get<FoodInd>().x);
+    }
+}
+BENCHMARK(BM_TypedPayloadAccess);
+
+} // namespace
+} // namespace Snake
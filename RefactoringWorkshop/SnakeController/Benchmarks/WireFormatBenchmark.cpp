@@ -0,0 +1,67 @@
+#include "SnakeWireFormat.hpp"
+
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "EventT.hpp"
+
+namespace Snake
+{
+namespace
+{
+
+constexpr std::size_t c_ticks = 1024;
+
+struct CountingHandler : IEventHandler
+{
+    void receive(std::unique_ptr<Event>) override { ++received; }
+
+    std::size_t received = 0;
+};
+
+// A typical tick on the wire: the timeout, the freed tail and the new head.
+std::vector<std::unique_ptr<Event>> makeTicks()
+{
+    std::vector<std::unique_ptr<Event>> l_events;
+    for (std::size_t i = 0; i < c_ticks; ++i) {
+        int const x = static_cast<int>(i);
+        l_events.push_back(std::make_unique<EventT<TimeoutInd>>());
+        l_events.push_back(std::make_unique<EventT<DisplayInd>>(DisplayInd{x, 10, Cell_FREE}));
+        l_events.push_back(std::make_unique<EventT<DisplayInd>>(DisplayInd{x + 5, 10, Cell_SNAKE}));
+    }
+    return l_events;
+}
+
+void BM_WireEncodeBatch(benchmark::State& state)
+{
+    auto l_events = makeTicks();
+    std::vector<unsigned char> l_buffer;
+
+    for (auto _ : state) {
+        l_buffer.clear();
+        WireCodec::encode(EventBatch{l_events.data(), l_events.size()}, l_buffer);
+        benchmark::DoNotOptimize(l_buffer.data());
+    }
+    state.SetItemsProcessed(state.iterations() * l_events.size());
+    state.SetBytesProcessed(state.iterations() * l_buffer.size());
+}
+BENCHMARK(BM_WireEncodeBatch);
+
+void BM_WireDecodeBatch(benchmark::State& state)
+{
+    auto l_events = makeTicks();
+    std::vector<unsigned char> l_buffer;
+    WireCodec::encode(EventBatch{l_events.data(), l_events.size()}, l_buffer);
+    CountingHandler l_handler;
+
+    for (auto _ : state) {
+        WireCodec::decode(l_buffer.data(), l_buffer.size(), l_handler);
+    }
+    state.SetItemsProcessed(state.iterations() * l_events.size());
+    state.SetBytesProcessed(state.iterations() * l_buffer.size());
+}
+BENCHMARK(BM_WireDecodeBatch);
+
+} // namespace
+} // namespace Snake
@@ -0,0 +1,140 @@
+#include "BoardPublisher.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <utility>
+
+namespace Snake
+{
+
+constexpr std::size_t BoardPublisher::c_statusWords;
+
+Cell PublishedBoard::cell(int p_x, int p_y) const
+{
+    if (unsigned(p_x) >= unsigned(width) or unsigned(p_y) >= unsigned(height)) {
+        return Cell_FREE;
+    }
+    std::uint64_t const l_word = cells[std::size_t(p_y) * rowWords + std::size_t(p_x) / 32];
+    return static_cast<Cell>((l_word >> (2 * (p_x % 32))) & 0b11);
+}
+
+BoardPublisher::BoardPublisher(int p_width, int p_height, std::size_t p_copies)
+    : m_width(std::max(p_width, 0)),
+      m_height(std::max(p_height, 0)),
+      m_rowWords((std::size_t(m_width) + 31) / 32),
+      m_cellWords(m_rowWords * std::size_t(m_height)),
+      m_copyCount(std::max<std::size_t>(p_copies, 2)),
+      m_copies(new Copy[m_copyCount]),
+      m_updates(m_copyCount),
+      m_published(0)
+{
+    for (std::size_t i = 0; i < m_copyCount; ++i) {
+        m_copies[i].words.reset(new std::atomic<std::uint64_t>[c_statusWords + m_cellWords]);
+        for (std::size_t word = 0; word < c_statusWords + m_cellWords; ++word) {
+            m_copies[i].words[word].store(0, std::memory_order_relaxed);
+        }
+    }
+}
+
+BoardPublisher::~BoardPublisher() = default;
+
+void BoardPublisher::clear()
+{
+    m_staged.clear = true;
+    m_staged.cells.clear();
+}
+
+void BoardPublisher::draw(int p_x, int p_y, Cell p_value)
+{
+    if (unsigned(p_x) < unsigned(m_width) and unsigned(p_y) < unsigned(m_height)) {
+        m_staged.cells.push_back(DrawnCell{p_x, p_y, p_value});
+    }
+}
+
+void BoardPublisher::publish(BoardStatus const& p_status)
+{
+    std::uint64_t const l_number = m_published.load(std::memory_order_relaxed) + 1;
+
+    // Swapping keeps the capacity of both vectors, so that a game in
+    // progress publishes without allocating.
+    Update& l_update = m_updates[l_number % m_copyCount];
+    std::swap(l_update, m_staged);
+    m_staged.clear = false;
+    m_staged.cells.clear();
+
+    Copy& l_copy = m_copies[l_number % m_copyCount];
+    std::uint64_t const l_shown = l_copy.sequence.load(std::memory_order_relaxed) / 2;
+
+    l_copy.sequence.store(2 * l_number + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    // The copy shows update l_number - m_copyCount, or none yet; the ones
+    // since are all still in m_updates.
+    for (std::uint64_t l_missed = l_shown + 1; l_missed <= l_number; ++l_missed) {
+        apply(m_updates[l_missed % m_copyCount], &l_copy.words[c_statusWords]);
+    }
+
+    std::uint64_t l_status[c_statusWords];
+    std::memcpy(l_status, &p_status, sizeof(p_status));
+    for (std::size_t i = 0; i < c_statusWords; ++i) {
+        l_copy.words[i].store(l_status[i], std::memory_order_relaxed);
+    }
+
+    l_copy.sequence.store(2 * l_number, std::memory_order_release);
+    m_published.store(l_number, std::memory_order_release);
+}
+
+void BoardPublisher::apply(Update const& p_update, std::atomic<std::uint64_t>* p_cells)
+{
+    if (p_update.clear) {
+        for (std::size_t i = 0; i < m_cellWords; ++i) {
+            p_cells[i].store(0, std::memory_order_relaxed);
+        }
+    }
+
+    for (DrawnCell const& l_cell : p_update.cells) {
+        std::atomic<std::uint64_t>& l_word = p_cells[std::size_t(l_cell.y) * m_rowWords + std::size_t(l_cell.x) / 32];
+        unsigned const l_shift = 2 * unsigned(l_cell.x % 32);
+        std::uint64_t const l_value = std::uint64_t(l_cell.value & 0b11) << l_shift;
+        l_word.store((l_word.load(std::memory_order_relaxed) & ~(std::uint64_t(0b11) << l_shift)) | l_value,
+                     std::memory_order_relaxed);
+    }
+}
+
+std::uint64_t BoardPublisher::read(PublishedBoard& p_out) const
+{
+    for (;;) {
+        std::uint64_t const l_number = m_published.load(std::memory_order_acquire);
+        if (l_number == 0) {
+            return 0;
+        }
+
+        Copy const& l_copy = m_copies[l_number % m_copyCount];
+        std::uint64_t const l_sequence = l_copy.sequence.load(std::memory_order_acquire);
+        if (l_sequence != 2 * l_number) {
+            continue; // already being brought up to a later update
+        }
+
+        p_out.width = m_width;
+        p_out.height = m_height;
+        p_out.rowWords = m_rowWords;
+        p_out.cells.resize(m_cellWords);
+
+        std::uint64_t l_status[c_statusWords];
+        for (std::size_t i = 0; i < c_statusWords; ++i) {
+            l_status[i] = l_copy.words[i].load(std::memory_order_relaxed);
+        }
+        std::atomic<std::uint64_t> const* const l_cells = &l_copy.words[c_statusWords];
+        for (std::size_t i = 0; i < m_cellWords; ++i) {
+            p_out.cells[i] = l_cells[i].load(std::memory_order_relaxed);
+        }
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (l_copy.sequence.load(std::memory_order_relaxed) == l_sequence) {
+            std::memcpy(&p_out.status, l_status, sizeof(l_status));
+            return l_number;
+        }
+    }
+}
+
+} // namespace Snake
@@ -0,0 +1,117 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "SnakeInterface.hpp"
+
+namespace Snake
+{
+
+// What a published board tells besides its cells.
+struct BoardStatus
+{
+    std::int32_t headX;
+    std::int32_t headY;
+    std::int32_t foodX;
+    std::int32_t foodY;
+    std::int32_t direction;
+    std::uint32_t length;
+    std::int64_t age;
+};
+
+// A board as a reader got it. Cells are stored as in FramebufferPort:
+// 2 bits each, rows padded to whole 64-bit words.
+struct PublishedBoard
+{
+    BoardStatus status;
+    int width;
+    int height;
+    std::size_t rowWords;
+    std::vector<std::uint64_t> cells;
+
+    // Cell_FREE outside the board.
+    Cell cell(int p_x, int p_y) const;
+};
+
+// Hands the board of a game from one writer thread to any number of
+// reader threads without locks. An update is the few cells an event
+// changed; the writer stages them with draw() and ends the update with
+// publish().
+//
+// The board is kept in a ring of seqlocked copies. publish() rewrites the
+// oldest copy by replaying the updates it has missed, one per copy, so it
+// costs the cells those updates drew times the number of copies, whatever
+// the size of the board. It never waits for readers. A read copies the
+// whole latest copy and only has to start over when the writer has gone
+// round the ring while it was copying.
+class BoardPublisher
+{
+public:
+    BoardPublisher(int p_width, int p_height, std::size_t p_copies = 4);
+    ~BoardPublisher();
+
+    BoardPublisher(BoardPublisher const&) = delete;
+    BoardPublisher& operator=(BoardPublisher const&) = delete;
+
+    int width() const { return m_width; }
+    int height() const { return m_height; }
+
+    // Writer thread only. clear() frees every cell before the cells drawn
+    // for the same update; cells outside the board are dropped.
+    void clear();
+    void draw(int p_x, int p_y, Cell p_value);
+    void publish(BoardStatus const& p_status);
+
+    // Any thread. Replaces p_out with the latest board and returns how many
+    // updates had been published by then, 0 when none had (p_out is left
+    // alone then).
+    std::uint64_t read(PublishedBoard& p_out) const;
+
+    std::uint64_t published() const { return m_published.load(std::memory_order_acquire); }
+
+private:
+    static constexpr std::size_t c_statusWords = sizeof(BoardStatus) / 8;
+    static_assert(sizeof(BoardStatus) % 8 == 0, "BoardStatus is published in whole words");
+
+    struct DrawnCell
+    {
+        std::int32_t x;
+        std::int32_t y;
+        Cell value;
+    };
+
+    struct Update
+    {
+        bool clear = false;
+        std::vector<DrawnCell> cells;
+    };
+
+    struct Copy
+    {
+        // Twice the number of the update the copy shows, plus 1 while the
+        // writer brings it up to date.
+        std::atomic<std::uint64_t> sequence{0};
+        // The status words, then the cells.
+        std::unique_ptr<std::atomic<std::uint64_t>[]> words;
+    };
+
+    void apply(Update const& p_update, std::atomic<std::uint64_t>* p_cells);
+
+    int m_width;
+    int m_height;
+    std::size_t m_rowWords;
+    std::size_t m_cellWords;
+    std::size_t m_copyCount;
+    std::unique_ptr<Copy[]> m_copies;
+    // Writer only: the updates of the last m_copyCount publishes, by
+    // number, and the one being staged.
+    std::vector<Update> m_updates;
+    Update m_staged;
+    std::atomic<std::uint64_t> m_published;
+};
+
+} // namespace Snake
@@ -0,0 +1,107 @@
+#include "CoalescingDisplayPort.hpp"
+
+#include <algorithm>
+
+#include "EventT.hpp"
+#include "SnakeInterface.hpp"
+
+namespace Snake
+{
+namespace
+{
+constexpr std::size_t c_initialSlots = 16;
+
+std::uint64_t cellKey(DisplayInd const& p_displayInd)
+{
+    return (std::uint64_t(std::uint32_t(p_displayInd.x)) << 32) | std::uint32_t(p_displayInd.y);
+}
+
+DisplayInd const& displayInd(Event const& p_evt)
+{
+    return *eventCast<DisplayInd>(p_evt);
+}
+} // namespace
+
+CoalescingDisplayPort::CoalescingDisplayPort(IPort& p_downstream)
+    : m_downstream(p_downstream),
+      m_dropped(0),
+      m_slots(c_initialSlots, Slot{0, 0, 0}),
+      m_cellCount(0),
+      m_generation(1)
+{}
+
+CoalescingDisplayPort::~CoalescingDisplayPort() = default;
+
+void CoalescingDisplayPort::send(std::unique_ptr<Event> p_evt)
+{
+    if (p_evt->getMessageId() != DisplayInd::MESSAGE_ID) {
+        m_pending.push_back(std::move(p_evt));
+        return;
+    }
+
+    if (2 * (m_cellCount + 1) > m_slots.size()) {
+        grow();
+    }
+
+    Slot& l_slot = findSlot(cellKey(displayInd(*p_evt)));
+    if (l_slot.generation == m_generation) {
+        m_pending[l_slot.index] = std::move(p_evt);
+        ++m_dropped;
+    } else {
+        l_slot.generation = m_generation;
+        l_slot.index = static_cast<std::uint32_t>(m_pending.size());
+        m_pending.push_back(std::move(p_evt));
+        ++m_cellCount;
+    }
+}
+
+void CoalescingDisplayPort::sendBatch(EventBatch p_events)
+{
+    for (auto& l_evt : p_events) {
+        send(std::move(l_evt));
+    }
+}
+
+void CoalescingDisplayPort::flush()
+{
+    if (m_pending.empty()) {
+        return;
+    }
+
+    m_downstream.sendBatch(EventBatch{m_pending.data(), m_pending.size()});
+    m_pending.clear();
+    m_cellCount = 0;
+
+    if (not ++m_generation) {
+        std::fill(m_slots.begin(), m_slots.end(), Slot{0, 0, 0});
+        m_generation = 1;
+    }
+}
+
+CoalescingDisplayPort::Slot& CoalescingDisplayPort::findSlot(std::uint64_t p_key)
+{
+    std::size_t const l_mask = m_slots.size() - 1;
+    std::size_t l_pos = (p_key * 0x9E3779B97F4A7C15ull) >> 32 & l_mask;
+
+    while (m_slots[l_pos].generation == m_generation and m_slots[l_pos].key != p_key) {
+        l_pos = (l_pos + 1) & l_mask;
+    }
+
+    m_slots[l_pos].key = p_key;
+    return m_slots[l_pos];
+}
+
+void CoalescingDisplayPort::grow()
+{
+    m_slots.assign(2 * m_slots.size(), Slot{0, 0, 0});
+
+    for (std::size_t i = 0; i < m_pending.size(); ++i) {
+        if (m_pending[i]->getMessageId() == DisplayInd::MESSAGE_ID) {
+            Slot& l_slot = findSlot(cellKey(displayInd(*m_pending[i])));
+            l_slot.generation = m_generation;
+            l_slot.index = static_cast<std::uint32_t>(i);
+        }
+    }
+}
+
+} // namespace Snake
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "IPort.hpp"
+
+class Event;
+
+namespace Snake
+{
+
+// Collects everything sent to a display port during one tick and forwards
+// it downstream as a single sendBatch on flush(). A DisplayInd for a cell
+// that already has a pending update replaces it in place, so the batch
+// carries at most one write per cell (the last one). Other events are
+// forwarded untouched, in order.
+class CoalescingDisplayPort : public IPort
+{
+public:
+    explicit CoalescingDisplayPort(IPort& p_downstream);
+    ~CoalescingDisplayPort();
+
+    CoalescingDisplayPort(CoalescingDisplayPort const&) = delete;
+    CoalescingDisplayPort& operator=(CoalescingDisplayPort const&) = delete;
+
+    void send(std::unique_ptr<Event> p_evt) override;
+    void sendBatch(EventBatch p_events) override;
+
+    void flush();
+
+    std::size_t pending() const { return m_pending.size(); }
+    std::size_t dropped() const { return m_dropped; }
+
+private:
+    struct Slot
+    {
+        std::uint64_t key;
+        std::uint32_t generation;
+        std::uint32_t index;
+    };
+
+    Slot& findSlot(std::uint64_t p_key);
+    void grow();
+
+    IPort& m_downstream;
+    std::vector<std::unique_ptr<Event>> m_pending;
+    std::size_t m_dropped;
+
+    // Open-addressed cell -> m_pending index map. Slots from previous ticks
+    // are invalidated by bumping m_generation rather than by clearing.
+    std::vector<Slot> m_slots;
+    std::size_t m_cellCount;
+    std::uint32_t m_generation;
+};
+
+} // namespace Snake
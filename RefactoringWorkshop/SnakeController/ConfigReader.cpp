@@ -0,0 +1,213 @@
+#include "ConfigReader.hpp"
+
+#include <cstring>
+#include <limits>
+
+namespace Snake
+{
+namespace
+{
+
+bool isSpace(char p_char)
+{
+    return p_char == ' ' or p_char == '\t' or p_char == '\n' or p_char == '\r' or p_char == '\v' or p_char == '\f';
+}
+
+bool isDigit(char p_char)
+{
+    return p_char >= '0' and p_char <= '9';
+}
+
+} // namespace
+
+ConfigurationError::ConfigurationError(std::size_t p_position, char const* p_reason)
+    : std::logic_error("Bad configuration of Snake::Controller at offset " + std::to_string(p_position) + ": " + p_reason + "."),
+      m_position(p_position)
+{}
+
+TextConfigReader::TextConfigReader(char const* p_begin, char const* p_end)
+    : m_begin(p_begin),
+      m_cursor(p_begin),
+      m_end(p_end)
+{}
+
+TextConfigReader::TextConfigReader(std::string const& p_config)
+    : TextConfigReader(p_config.data(), p_config.data() + p_config.size())
+{}
+
+ConfigHeader TextConfigReader::readHeader()
+{
+    ConfigHeader l_header;
+
+    expectLetter('W');
+    l_header.width = readPositive();
+    l_header.height = readPositive();
+    expectLetter('F');
+    l_header.foodX = readNumber();
+    l_header.foodY = readNumber();
+    expectLetter('S');
+    l_header.direction = readDirection();
+    l_header.length = readPositive();
+
+    return l_header;
+}
+
+void TextConfigReader::readSegment(int& p_x, int& p_y)
+{
+    p_x = readNumber();
+    p_y = readNumber();
+}
+
+std::size_t TextConfigReader::position()
+{
+    skipSpaces();
+    return static_cast<std::size_t>(m_cursor - m_begin);
+}
+
+void TextConfigReader::skipSpaces()
+{
+    while (m_cursor != m_end and isSpace(*m_cursor)) {
+        ++m_cursor;
+    }
+}
+
+void TextConfigReader::expectLetter(char p_letter)
+{
+    skipSpaces();
+    if (m_cursor == m_end or *m_cursor != p_letter) {
+        throw ConfigurationError(position(), "unexpected item, section letter expected");
+    }
+    ++m_cursor;
+}
+
+int TextConfigReader::readNumber()
+{
+    std::size_t const l_position = position();
+
+    bool const l_negative = m_cursor != m_end and *m_cursor == '-';
+    if (m_cursor != m_end and (*m_cursor == '-' or *m_cursor == '+')) {
+        ++m_cursor;
+    }
+    if (m_cursor == m_end or not isDigit(*m_cursor)) {
+        throw ConfigurationError(l_position, "number expected");
+    }
+
+    long long l_value = 0;
+    while (m_cursor != m_end and isDigit(*m_cursor)) {
+        l_value = l_value * 10 + (*m_cursor++ - '0');
+        if (l_value > std::numeric_limits<int>::max()) {
+            throw ConfigurationError(l_position, "number out of range");
+        }
+    }
+    return static_cast<int>(l_negative ? -l_value : l_value);
+}
+
+int TextConfigReader::readPositive()
+{
+    std::size_t const l_position = position();
+    int const l_value = readNumber();
+    if (l_value <= 0) {
+        throw ConfigurationError(l_position, "positive number expected");
+    }
+    return l_value;
+}
+
+Direction TextConfigReader::readDirection()
+{
+    std::size_t const l_position = position();
+    if (m_cursor != m_end) {
+        switch (*m_cursor++) {
+            case 'U':
+                return Direction_UP;
+            case 'D':
+                return Direction_DOWN;
+            case 'L':
+                return Direction_LEFT;
+            case 'R':
+                return Direction_RIGHT;
+        }
+    }
+    throw ConfigurationError(l_position, "direction U, D, L or R expected");
+}
+
+BinaryConfigReader::BinaryConfigReader(BinaryConfig p_config)
+    : m_config(p_config),
+      m_offset(0)
+{}
+
+ConfigHeader BinaryConfigReader::readHeader()
+{
+    ConfigHeader l_header;
+
+    l_header.width = readPositiveField();
+    l_header.height = readPositiveField();
+    l_header.foodX = readField();
+    l_header.foodY = readField();
+
+    std::size_t const l_directionOffset = m_offset;
+    std::int32_t const l_direction = readField();
+    if (l_direction < Direction_UP or l_direction > Direction_RIGHT) {
+        throw ConfigurationError(l_directionOffset, "unknown direction");
+    }
+    l_header.direction = static_cast<Direction>(l_direction);
+
+    l_header.length = readPositiveField();
+
+    return l_header;
+}
+
+void BinaryConfigReader::readSegment(int& p_x, int& p_y)
+{
+    p_x = readField();
+    p_y = readField();
+}
+
+std::int32_t BinaryConfigReader::readField()
+{
+    if (m_config.size - m_offset < sizeof(std::int32_t)) {
+        throw ConfigurationError(m_offset, "binary config is truncated");
+    }
+
+    std::int32_t l_value;
+    std::memcpy(&l_value, m_config.data + m_offset, sizeof(l_value));
+    m_offset += sizeof(l_value);
+    return l_value;
+}
+
+std::int32_t BinaryConfigReader::readPositiveField()
+{
+    std::size_t const l_offset = m_offset;
+    std::int32_t const l_value = readField();
+    if (l_value <= 0) {
+        throw ConfigurationError(l_offset, "positive number expected");
+    }
+    return l_value;
+}
+
+void encodeBinaryConfig(std::string const& p_config, std::vector<unsigned char>& p_out)
+{
+    auto const l_append = [&p_out](std::int32_t p_value) {
+        unsigned char l_bytes[sizeof(p_value)];
+        std::memcpy(l_bytes, &p_value, sizeof(p_value));
+        p_out.insert(p_out.end(), l_bytes, l_bytes + sizeof(l_bytes));
+    };
+
+    TextConfigReader l_reader(p_config);
+    ConfigHeader const l_header = l_reader.readHeader();
+
+    l_append(l_header.width);
+    l_append(l_header.height);
+    l_append(l_header.foodX);
+    l_append(l_header.foodY);
+    l_append(l_header.direction);
+    l_append(l_header.length);
+
+    for (int i = 0; i < l_header.length; ++i) {
+        int x, y;
+        l_reader.readSegment(x, y);
+        l_append(x);
+        l_append(y);
+    }
+}
+
+} // namespace Snake
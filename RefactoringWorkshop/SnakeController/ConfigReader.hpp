@@ -0,0 +1,96 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "SnakeInterface.hpp"
+
+namespace Snake
+{
+
+struct ConfigurationError : std::logic_error
+{
+    ConfigurationError(std::size_t p_position, char const* p_reason);
+
+    // Offset in the config of the item at fault.
+    std::size_t position() const { return m_position; }
+
+private:
+    std::size_t m_position;
+};
+
+// Everything a controller config holds before its list of segments.
+struct ConfigHeader
+{
+    int width;
+    int height;
+    int foodX;
+    int foodY;
+    Direction direction;
+    int length;
+};
+
+// Scans the text form "W width height F x y S direction length x y ...",
+// items separated by any amount of whitespace, without copying or
+// allocating. Throws ConfigurationError carrying the offset of the item
+// at fault.
+class TextConfigReader
+{
+public:
+    TextConfigReader(char const* p_begin, char const* p_end);
+    explicit TextConfigReader(std::string const& p_config);
+    explicit TextConfigReader(std::string&&) = delete; // would dangle
+
+    ConfigHeader readHeader();
+    void readSegment(int& p_x, int& p_y);
+
+    // Offset of the next item.
+    std::size_t position();
+
+private:
+    void skipSpaces();
+    void expectLetter(char p_letter);
+    int readNumber();
+    int readPositive();
+    Direction readDirection();
+
+    char const* m_begin;
+    char const* m_cursor;
+    char const* m_end;
+};
+
+// Binary form of a config, for creating sessions in bulk: six host order
+// 32-bit integers (width, height, food x, food y, Direction value, length)
+// followed by an x, y pair of 32-bit integers per segment, head first.
+struct BinaryConfig
+{
+    unsigned char const* data;
+    std::size_t size;
+};
+
+class BinaryConfigReader
+{
+public:
+    explicit BinaryConfigReader(BinaryConfig p_config);
+
+    ConfigHeader readHeader();
+    void readSegment(int& p_x, int& p_y);
+
+    // Offset of the next field.
+    std::size_t position() const { return m_offset; }
+
+private:
+    std::int32_t readField();
+    std::int32_t readPositiveField();
+
+    BinaryConfig m_config;
+    std::size_t m_offset;
+};
+
+// Appends the binary form of the text config p_config to p_out.
+void encodeBinaryConfig(std::string const& p_config, std::vector<unsigned char>& p_out);
+
+} // namespace Snake
@@ -0,0 +1,122 @@
+#include "ControllerMetrics.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <ostream>
+
+namespace Snake
+{
+
+LatencyHistogram::LatencyHistogram()
+    : m_count(0),
+      m_total(0),
+      m_max(0)
+{
+    m_buckets.fill(0);
+}
+
+void LatencyHistogram::record(std::uint64_t p_nanoseconds)
+{
+    ++m_buckets[bucketOf(p_nanoseconds)];
+    ++m_count;
+    m_total += p_nanoseconds;
+    m_max = std::max(m_max, p_nanoseconds);
+}
+
+std::uint64_t LatencyHistogram::percentile(double p_percent) const
+{
+    if (not m_count) {
+        return 0;
+    }
+
+    auto const l_rank = std::max<std::uint64_t>(1, static_cast<std::uint64_t>(std::ceil(p_percent / 100 * m_count)));
+    std::uint64_t l_seen = 0;
+    // The last bucket has no upper bound of its own.
+    for (unsigned i = 0; i + 1 < c_bucketCount; ++i) {
+        l_seen += m_buckets[i];
+        if (l_seen >= l_rank) {
+            return std::min(upperBoundOf(i), m_max);
+        }
+    }
+    return m_max;
+}
+
+unsigned LatencyHistogram::bucketOf(std::uint64_t p_value)
+{
+    if (p_value < c_subBuckets) {
+        return static_cast<unsigned>(p_value);
+    }
+
+    unsigned const l_highestBit = 63 - __builtin_clzll(p_value);
+    if (l_highestBit >= c_maxBits) {
+        return c_bucketCount - 1;
+    }
+
+    unsigned const l_shift = l_highestBit - c_subBucketBits;
+    return (l_shift + 1) * c_subBuckets + static_cast<unsigned>(p_value >> l_shift) - c_subBuckets;
+}
+
+std::uint64_t LatencyHistogram::upperBoundOf(unsigned p_bucket)
+{
+    unsigned const l_block = p_bucket / c_subBuckets;
+    std::uint64_t const l_subBucket = p_bucket % c_subBuckets;
+    if (l_block == 0) {
+        return l_subBucket;
+    }
+
+    unsigned const l_shift = l_block - 1;
+    return ((l_subBucket + c_subBuckets) << l_shift) + (std::uint64_t(1) << l_shift) - 1;
+}
+
+MessageMetrics const* ControllerMetrics::find(std::uint32_t p_messageId) const
+{
+    for (auto const& l_message : messages) {
+        if (l_message.messageId == p_messageId) {
+            return &l_message;
+        }
+    }
+    return nullptr;
+}
+
+LatencyHistogram& ControllerMetrics::receiveLatency(std::uint32_t p_messageId)
+{
+    for (auto& l_message : messages) {
+        if (l_message.messageId == p_messageId) {
+            return l_message.receiveLatency;
+        }
+    }
+
+    messages.push_back(MessageMetrics{p_messageId, LatencyHistogram()});
+    return messages.back().receiveLatency;
+}
+
+namespace
+{
+
+void writeHistogram(std::ostream& p_out, LatencyHistogram const& p_histogram)
+{
+    p_out << "\"count\":" << p_histogram.count()
+          << ",\"totalNs\":" << p_histogram.total()
+          << ",\"p50Ns\":" << p_histogram.percentile(50)
+          << ",\"p90Ns\":" << p_histogram.percentile(90)
+          << ",\"p99Ns\":" << p_histogram.percentile(99)
+          << ",\"p999Ns\":" << p_histogram.percentile(99.9)
+          << ",\"maxNs\":" << p_histogram.max();
+}
+
+} // namespace
+
+void writeMetrics(std::ostream& p_out, ControllerMetrics const& p_metrics)
+{
+    p_out << "{\"receive\":[";
+    for (std::size_t i = 0; i < p_metrics.messages.size(); ++i) {
+        p_out << (i ? ",{" : "{") << "\"messageId\":" << p_metrics.messages[i].messageId << ",";
+        writeHistogram(p_out, p_metrics.messages[i].receiveLatency);
+        p_out << "}";
+    }
+    p_out << "],\"portSend\":{";
+    writeHistogram(p_out, p_metrics.portSendLatency);
+    p_out << "}}";
+}
+
+} // namespace Snake
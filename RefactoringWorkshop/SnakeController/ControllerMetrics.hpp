@@ -0,0 +1,68 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <iosfwd>
+#include <vector>
+
+namespace Snake
+{
+
+// Histogram of latencies in nanoseconds with HDR-style buckets: values are
+// grouped by their highest set bit and every power of two is split into
+// c_subBuckets linear sub-buckets, so a reported percentile is at most
+// 1/c_subBuckets above the exact one. Values from 2^c_maxBits ns (about a
+// minute) up land in the last bucket.
+class LatencyHistogram
+{
+public:
+    LatencyHistogram();
+
+    void record(std::uint64_t p_nanoseconds);
+
+    std::uint64_t count() const { return m_count; }
+    std::uint64_t total() const { return m_total; }
+    std::uint64_t max() const { return m_max; }
+
+    // Upper bound of the bucket holding the p_percent-th percentile,
+    // 0 for an empty histogram.
+    std::uint64_t percentile(double p_percent) const;
+
+private:
+    static constexpr unsigned c_subBucketBits = 3;
+    static constexpr unsigned c_subBuckets = 1u << c_subBucketBits;
+    static constexpr unsigned c_maxBits = 36;
+    static constexpr unsigned c_bucketCount = (c_maxBits - c_subBucketBits + 1) * c_subBuckets;
+
+    static unsigned bucketOf(std::uint64_t p_value);
+    static std::uint64_t upperBoundOf(unsigned p_bucket);
+
+    std::array<std::uint64_t, c_bucketCount> m_buckets;
+    std::uint64_t m_count;
+    std::uint64_t m_total;
+    std::uint64_t m_max;
+};
+
+struct MessageMetrics
+{
+    std::uint32_t messageId;
+    LatencyHistogram receiveLatency; // its count() is the number received
+};
+
+// Snapshot of what one Controller measured. receive latency includes the
+// port sends made while handling the event; these are also accounted for
+// on their own in portSendLatency.
+struct ControllerMetrics
+{
+    std::vector<MessageMetrics> messages; // in order of first arrival
+    LatencyHistogram portSendLatency;
+
+    // nullptr when no event with p_messageId was received.
+    MessageMetrics const* find(std::uint32_t p_messageId) const;
+    LatencyHistogram& receiveLatency(std::uint32_t p_messageId);
+};
+
+// Writes p_metrics as one JSON object.
+void writeMetrics(std::ostream& p_out, ControllerMetrics const& p_metrics);
+
+} // namespace Snake
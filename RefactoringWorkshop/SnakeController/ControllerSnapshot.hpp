@@ -0,0 +1,46 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace Snake
+{
+
+// Binary image of a Controller's game state, written by
+// Controller::snapshot(): a SnapshotHeader followed by one SnapshotSegment
+// per segment, head first. A controller that relocates colliding food
+// appends the slot order of its FreeCellIndex, one std::uint32_t per cell
+// of the map, since the cell it picks depends on it. Fields are in host
+// order, so snapshots move between processes on the same kind of machine.
+struct ControllerSnapshot
+{
+    unsigned char const* data;
+    std::size_t size;
+};
+
+struct SnapshotHeader
+{
+    std::uint32_t magic;
+    std::uint32_t size; // of the whole snapshot, header included
+    std::int32_t width;
+    std::int32_t height;
+    std::int32_t foodX;
+    std::int32_t foodY;
+    std::int32_t direction;
+    std::uint32_t length;
+    std::int64_t age;
+    std::uint32_t flags; // snapshotRelocatesFood
+    std::uint32_t random; // state of the engine relocating food, 0 if none
+};
+
+struct SnapshotSegment
+{
+    std::int32_t x;
+    std::int32_t y;
+    std::int64_t expiry;
+};
+
+constexpr std::uint32_t snapshotMagic = 0x534e4b32; // "SNK2"
+constexpr std::uint32_t snapshotRelocatesFood = 0x1;
+
+} // namespace Snake
@@ -0,0 +1,294 @@
+#include "DisplayStream.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+
+#include "EventT.hpp"
+
+namespace Snake
+{
+namespace
+{
+
+enum FrameKind : unsigned char
+{
+    FrameKind_DELTA    = 0,
+    FrameKind_KEYFRAME = 1
+};
+
+// Keeps a corrupt keyframe from making the decoder allocate gigabytes.
+constexpr std::uint64_t c_maxBoardCells = std::uint64_t(1) << 26;
+
+void writeVarint(std::uint64_t p_value, std::vector<unsigned char>& p_out)
+{
+    while (p_value >= 0x80) {
+        p_out.push_back(static_cast<unsigned char>(p_value | 0x80));
+        p_value >>= 7;
+    }
+    p_out.push_back(static_cast<unsigned char>(p_value));
+}
+
+std::uint64_t zigzag(std::int64_t p_value)
+{
+    return (std::uint64_t(p_value) << 1) ^ std::uint64_t(p_value >> 63);
+}
+
+std::int64_t unzigzag(std::uint64_t p_value)
+{
+    return std::int64_t(p_value >> 1) ^ -std::int64_t(p_value & 1);
+}
+
+// Returns false, leaving p_data alone, when the varint runs past p_end.
+bool tryReadVarint(unsigned char const*& p_data, unsigned char const* p_end, std::uint64_t& p_value)
+{
+    p_value = 0;
+    for (unsigned char const* l_cursor = p_data; l_cursor != p_end; ++l_cursor) {
+        unsigned const l_shift = 7 * unsigned(l_cursor - p_data);
+        if (l_shift > 63) {
+            throw DisplayStreamError("varint too long");
+        }
+        p_value |= std::uint64_t(*l_cursor & 0x7f) << l_shift;
+        if (not (*l_cursor & 0x80)) {
+            p_data = l_cursor + 1;
+            return true;
+        }
+    }
+    return false;
+}
+
+std::uint64_t readVarint(unsigned char const*& p_data, unsigned char const* p_end)
+{
+    std::uint64_t l_value;
+    if (not tryReadVarint(p_data, p_end, l_value)) {
+        throw DisplayStreamError("frame is truncated");
+    }
+    return l_value;
+}
+
+// End of the run of equal cells starting at p_start. Boards are mostly
+// empty, so whole words are compared while they match.
+std::size_t runEnd(std::vector<std::uint8_t> const& p_board, std::size_t p_start)
+{
+    std::uint8_t const l_value = p_board[p_start];
+    std::uint64_t const l_word = l_value * 0x0101010101010101ull;
+
+    std::size_t i = p_start + 1;
+    for (std::uint64_t l_next; i + sizeof(l_next) <= p_board.size(); i += sizeof(l_next)) {
+        std::memcpy(&l_next, &p_board[i], sizeof(l_next));
+        if (l_next != l_word) {
+            break;
+        }
+    }
+    while (i < p_board.size() and p_board[i] == l_value) {
+        ++i;
+    }
+    return i;
+}
+
+Cell readCell(std::uint64_t p_item)
+{
+    if ((p_item & 0b11) > Cell_SNAKE) {
+        throw DisplayStreamError("unknown cell value");
+    }
+    return static_cast<Cell>(p_item & 0b11);
+}
+
+} // namespace
+
+DisplayStreamEncoder::DisplayStreamEncoder(int p_width, int p_height, unsigned p_keyframeInterval)
+    : m_width(p_width),
+      m_height(p_height),
+      m_keyframeInterval(p_keyframeInterval),
+      m_framesToKeyframe(0),
+      m_cursor(0),
+      m_board(std::size_t(p_width) * std::size_t(p_height), Cell_FREE)
+{}
+
+void DisplayStreamEncoder::add(DisplayInd const& p_displayInd)
+{
+    if (unsigned(p_displayInd.x) >= unsigned(m_width) or unsigned(p_displayInd.y) >= unsigned(m_height)) {
+        return;
+    }
+
+    std::uint32_t const l_index = std::uint32_t(p_displayInd.y) * std::uint32_t(m_width) + std::uint32_t(p_displayInd.x);
+    m_board[l_index] = static_cast<std::uint8_t>(p_displayInd.value);
+    m_pending.push_back(l_index << 2 | p_displayInd.value);
+}
+
+void DisplayStreamEncoder::finishFrame(std::vector<unsigned char>& p_out)
+{
+    bool const l_keyframe = m_framesToKeyframe == 0;
+    if (not l_keyframe and m_pending.empty()) {
+        return;
+    }
+
+    // The body is written in place after a one byte length, which is
+    // widened afterwards for the rare body of 128 bytes or more.
+    std::size_t const l_start = p_out.size();
+    p_out.push_back(0);
+
+    if (l_keyframe) {
+        writeKeyframe(p_out);
+        m_framesToKeyframe = m_keyframeInterval ? m_keyframeInterval : std::numeric_limits<unsigned>::max();
+    } else {
+        writeDelta(p_out);
+    }
+    --m_framesToKeyframe;
+    m_pending.clear();
+
+    std::size_t const l_length = p_out.size() - l_start - 1;
+    if (l_length < 0x80) {
+        p_out[l_start] = static_cast<unsigned char>(l_length);
+    } else {
+        std::vector<unsigned char> l_prefix;
+        writeVarint(l_length, l_prefix);
+        p_out[l_start] = l_prefix[0];
+        p_out.insert(p_out.begin() + l_start + 1, l_prefix.begin() + 1, l_prefix.end());
+    }
+}
+
+void DisplayStreamEncoder::writeDelta(std::vector<unsigned char>& p_out)
+{
+    p_out.push_back(FrameKind_DELTA);
+    writeVarint(m_pending.size(), p_out);
+
+    for (std::uint32_t const l_update : m_pending) {
+        std::uint32_t const l_index = l_update >> 2;
+        std::int64_t const l_delta = std::int64_t(l_index) - std::int64_t(m_cursor);
+        writeVarint(zigzag(l_delta) << 2 | (l_update & 0b11), p_out);
+        m_cursor = l_index;
+    }
+}
+
+void DisplayStreamEncoder::writeKeyframe(std::vector<unsigned char>& p_out)
+{
+    p_out.push_back(FrameKind_KEYFRAME);
+    writeVarint(std::uint64_t(m_width), p_out);
+    writeVarint(std::uint64_t(m_height), p_out);
+
+    for (std::size_t l_runStart = 0; l_runStart < m_board.size();) {
+        std::size_t const l_runEnd = runEnd(m_board, l_runStart);
+        writeVarint(std::uint64_t(l_runEnd - l_runStart - 1) << 2 | m_board[l_runStart], p_out);
+        l_runStart = l_runEnd;
+    }
+    m_cursor = 0;
+}
+
+DisplayStreamDecoder::DisplayStreamDecoder()
+    : m_width(0),
+      m_height(0),
+      m_cursor(0)
+{}
+
+std::size_t DisplayStreamDecoder::decode(unsigned char const* p_data, std::size_t p_size)
+{
+    unsigned char const* const l_begin = p_data;
+    unsigned char const* const l_end = p_data + p_size;
+
+    for (;;) {
+        unsigned char const* l_cursor = p_data;
+        std::uint64_t l_length;
+        if (not tryReadVarint(l_cursor, l_end, l_length) or l_length > std::uint64_t(l_end - l_cursor)) {
+            break;
+        }
+        if (l_length == 0) {
+            throw DisplayStreamError("empty frame");
+        }
+
+        unsigned char const* const l_frameEnd = l_cursor + l_length;
+        switch (*l_cursor) {
+            case FrameKind_DELTA:
+                if (synchronized()) {
+                    applyDelta(l_cursor + 1, l_frameEnd);
+                }
+                break;
+            case FrameKind_KEYFRAME:
+                applyKeyframe(l_cursor + 1, l_frameEnd);
+                break;
+            default:
+                throw DisplayStreamError("unknown frame kind");
+        }
+        p_data = l_frameEnd;
+    }
+
+    return static_cast<std::size_t>(p_data - l_begin);
+}
+
+void DisplayStreamDecoder::applyDelta(unsigned char const* p_data, unsigned char const* p_end)
+{
+    std::uint64_t l_count = readVarint(p_data, p_end);
+
+    while (l_count--) {
+        std::uint64_t const l_update = readVarint(p_data, p_end);
+        std::int64_t const l_index = std::int64_t(m_cursor) + unzigzag(l_update >> 2);
+        if (l_index < 0 or std::uint64_t(l_index) >= m_board.size()) {
+            throw DisplayStreamError("update outside the board");
+        }
+
+        m_board[std::size_t(l_index)] = static_cast<std::uint8_t>(readCell(l_update));
+        m_cursor = static_cast<std::uint32_t>(l_index);
+    }
+
+    if (p_data != p_end) {
+        throw DisplayStreamError("trailing bytes in frame");
+    }
+}
+
+void DisplayStreamDecoder::applyKeyframe(unsigned char const* p_data, unsigned char const* p_end)
+{
+    std::uint64_t const l_width = readVarint(p_data, p_end);
+    std::uint64_t const l_height = readVarint(p_data, p_end);
+    if (l_width == 0 or l_height == 0 or l_width > c_maxBoardCells or l_height > c_maxBoardCells or
+        l_width * l_height > c_maxBoardCells) {
+        throw DisplayStreamError("bad board dimensions");
+    }
+
+    // Runs are checked before the board is touched, so that a bad keyframe
+    // leaves the previous board in place.
+    std::uint64_t const l_cells = l_width * l_height;
+    std::uint64_t l_covered = 0;
+    for (unsigned char const* l_cursor = p_data; l_cursor != p_end;) {
+        std::uint64_t const l_run = readVarint(l_cursor, p_end);
+        readCell(l_run);
+        l_covered += (l_run >> 2) + 1;
+        if (l_covered > l_cells) {
+            throw DisplayStreamError("keyframe runs exceed the board");
+        }
+    }
+    if (l_covered != l_cells) {
+        throw DisplayStreamError("keyframe runs do not cover the board");
+    }
+
+    m_width = static_cast<int>(l_width);
+    m_height = static_cast<int>(l_height);
+    m_cursor = 0;
+    m_board.resize(l_cells);
+
+    auto l_cell = m_board.begin();
+    while (p_data != p_end) {
+        std::uint64_t const l_run = readVarint(p_data, p_end);
+        l_cell = std::fill_n(l_cell, (l_run >> 2) + 1, static_cast<std::uint8_t>(l_run & 0b11));
+    }
+}
+
+DisplayStreamPort::DisplayStreamPort(DisplayStreamEncoder& p_encoder, std::vector<unsigned char>& p_out)
+    : m_encoder(p_encoder),
+      m_out(p_out)
+{}
+
+void DisplayStreamPort::send(std::unique_ptr<Event> p_evt)
+{
+    m_encoder.add(payload<DisplayInd>(*p_evt));
+    m_encoder.finishFrame(m_out);
+}
+
+void DisplayStreamPort::sendBatch(EventBatch p_events)
+{
+    for (auto const& l_evt : p_events) {
+        m_encoder.add(payload<DisplayInd>(*l_evt));
+    }
+    m_encoder.finishFrame(m_out);
+}
+
+} // namespace Snake
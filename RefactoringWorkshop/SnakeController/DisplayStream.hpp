@@ -0,0 +1,113 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+#include "IPort.hpp"
+#include "SnakeInterface.hpp"
+
+class Event;
+
+namespace Snake
+{
+
+// Compact stream of display updates for remote viewers. Integers are
+// unsigned LEB128 varints; signed ones are zigzag encoded first. The
+// stream is a sequence of frames:
+//
+//   frame    = length kind body     length of kind and body in bytes
+//   delta    = count update*        kind 0
+//   update   = zigzag(index - cursor) << 2 | cell
+//   keyframe = width height run*    kind 1, runs cover the whole board
+//   run      = (cells - 1) << 2 | cell
+//
+// A cell index is y * width + x. The cursor is the index of the previous
+// update, carried over from frame to frame and reset to 0 by a keyframe,
+// so a snake moving along a row costs a byte per cell.
+struct DisplayStreamError : std::runtime_error
+{
+    explicit DisplayStreamError(char const* p_what)
+        : std::runtime_error(p_what)
+    {}
+};
+
+class DisplayStreamEncoder
+{
+public:
+    // Every p_keyframeInterval-th frame is a keyframe, the first one too.
+    // With 0, only the first one and requested ones are.
+    DisplayStreamEncoder(int p_width, int p_height, unsigned p_keyframeInterval);
+
+    // Updates outside the board are dropped: a viewer has nowhere to draw
+    // them.
+    void add(DisplayInd const& p_displayInd);
+
+    // Appends a frame with everything added since the previous one to
+    // p_out. Appends nothing when there is nothing to send and no keyframe
+    // is due.
+    void finishFrame(std::vector<unsigned char>& p_out);
+
+    // Makes the next frame a keyframe, e.g. for a viewer that just joined.
+    void requestKeyframe() { m_framesToKeyframe = 0; }
+
+private:
+    void writeDelta(std::vector<unsigned char>& p_out);
+    void writeKeyframe(std::vector<unsigned char>& p_out);
+
+    int m_width;
+    int m_height;
+    unsigned m_keyframeInterval;
+    unsigned m_framesToKeyframe;
+    std::uint32_t m_cursor;
+    std::vector<std::uint8_t> m_board;
+    std::vector<std::uint32_t> m_pending; // index << 2 | cell
+};
+
+// Rebuilds the board from a stream. Delta frames before the first
+// keyframe are skipped.
+class DisplayStreamDecoder
+{
+public:
+    DisplayStreamDecoder();
+
+    // Applies the whole frames at the start of p_data and returns the bytes
+    // they take; a trailing partial frame is left for the next call.
+    // Throws DisplayStreamError for a malformed frame.
+    std::size_t decode(unsigned char const* p_data, std::size_t p_size);
+
+    bool synchronized() const { return not m_board.empty(); }
+    int width() const { return m_width; }
+    int height() const { return m_height; }
+    Cell cell(int p_x, int p_y) const { return static_cast<Cell>(m_board[std::size_t(p_y) * m_width + p_x]); }
+
+private:
+    void applyDelta(unsigned char const* p_data, unsigned char const* p_end);
+    void applyKeyframe(unsigned char const* p_data, unsigned char const* p_end);
+
+    int m_width;
+    int m_height;
+    std::uint32_t m_cursor;
+    std::vector<std::uint8_t> m_board;
+};
+
+// Display port encoding what a controller sends it, one frame per send()
+// or sendBatch(). Frames are appended to the buffer given on construction,
+// which the transport drains. Throws std::bad_cast for events other than
+// DisplayInd.
+class DisplayStreamPort : public IPort
+{
+public:
+    DisplayStreamPort(DisplayStreamEncoder& p_encoder, std::vector<unsigned char>& p_out);
+
+    void send(std::unique_ptr<Event> p_evt) override;
+    void sendBatch(EventBatch p_events) override;
+
+private:
+    DisplayStreamEncoder& m_encoder;
+    std::vector<unsigned char>& m_out;
+};
+
+} // namespace Snake
@@ -0,0 +1,149 @@
+#include "EventLoop.hpp"
+
+#include <thread>
+
+#include "Event.hpp"
+#include "IEventHandler.hpp"
+
+namespace Snake
+{
+
+EventLoop::EventLoop(std::function<Clock::time_point()> p_now, std::function<void(Clock::time_point)> p_sleepUntil)
+    : m_now(std::move(p_now)),
+      m_sleepUntil(std::move(p_sleepUntil)),
+      m_lastTimerId(0)
+{}
+
+EventLoop::~EventLoop() = default;
+
+void EventLoop::post(std::function<void()> p_task)
+{
+    m_ready.push_back(Job{m_now(), 0, std::move(p_task), nullptr, nullptr});
+}
+
+void EventLoop::post(IEventHandler& p_handler, std::unique_ptr<Event> p_evt)
+{
+    m_ready.push_back(Job{m_now(), 0, nullptr, &p_handler, std::move(p_evt)});
+}
+
+EventLoop::TimerId EventLoop::startTimer(Clock::time_point p_due, std::function<void()> p_task)
+{
+    return startTimer(p_due, Clock::duration::zero(), std::move(p_task));
+}
+
+EventLoop::TimerId EventLoop::startTimer(Clock::time_point p_due, Clock::duration p_period, std::function<void()> p_task)
+{
+    TimerId const l_id = ++m_lastTimerId;
+    m_timers.emplace(l_id, Timer{p_period, std::move(p_task)});
+    m_dueTimers.push(DueTimer{p_due, l_id});
+    return l_id;
+}
+
+bool EventLoop::cancelTimer(TimerId p_id)
+{
+    // Its entry in m_dueTimers is dropped when it comes due.
+    return m_timers.erase(p_id) != 0;
+}
+
+std::size_t EventLoop::runOnce()
+{
+    collectDueTimers(m_now());
+
+    std::size_t l_ran = 0;
+    for (std::size_t l_left = m_ready.size(); l_left; --l_left) {
+        Job l_job = std::move(m_ready.front());
+        m_ready.pop_front();
+        l_ran += run(l_job, m_now());
+    }
+    return l_ran;
+}
+
+void EventLoop::runUntil(Clock::time_point p_deadline)
+{
+    while (m_now() < p_deadline) {
+        runOnce();
+
+        if (m_ready.empty()) {
+            Clock::time_point l_wakeUp = p_deadline;
+            if (not m_dueTimers.empty() and m_dueTimers.top().due < l_wakeUp) {
+                l_wakeUp = m_dueTimers.top().due;
+            }
+            m_sleepUntil(l_wakeUp);
+        }
+    }
+}
+
+void EventLoop::sleepUntil(Clock::time_point p_wakeUp)
+{
+    std::this_thread::sleep_until(p_wakeUp);
+}
+
+void EventLoop::collectDueTimers(Clock::time_point p_now)
+{
+    while (not m_dueTimers.empty() and m_dueTimers.top().due <= p_now) {
+        DueTimer const l_due = m_dueTimers.top();
+        m_dueTimers.pop();
+
+        auto const l_timer = m_timers.find(l_due.id);
+        if (l_timer == m_timers.end()) {
+            continue;
+        }
+        Clock::duration const l_period = l_timer->second.period;
+        if (l_period != Clock::duration::zero()) {
+            // After a stall, one run stands for all the periods missed.
+            Clock::time_point l_next = l_due.due + l_period;
+            if (l_next <= p_now) {
+                l_next += ((p_now - l_next) / l_period + 1) * l_period;
+            }
+            m_dueTimers.push(DueTimer{l_next, l_due.id});
+        }
+        m_ready.push_back(Job{l_due.due, l_due.id, nullptr, nullptr, nullptr});
+    }
+}
+
+bool EventLoop::run(Job& p_job, Clock::time_point p_start)
+{
+    auto const l_timer = p_job.timer ? m_timers.find(p_job.timer) : m_timers.end();
+    if (p_job.timer and l_timer == m_timers.end()) {
+        return false; // cancelled after it came due
+    }
+
+    m_schedulingLatency.record(static_cast<std::uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(p_start - p_job.due).count()));
+
+    if (p_job.handler) {
+        p_job.handler->receive(std::move(p_job.evt));
+        return true;
+    }
+    if (not p_job.timer) {
+        p_job.task();
+        return true;
+    }
+
+    // The task is taken out of the table while it runs, so that it may
+    // cancel its own timer or start new ones.
+    std::function<void()> l_task = std::move(l_timer->second.task);
+    bool const l_periodic = l_timer->second.period != Clock::duration::zero();
+    if (not l_periodic) {
+        m_timers.erase(l_timer);
+        l_task();
+        return true;
+    }
+
+    auto const l_restore = [this, &p_job, &l_task] {
+        auto const l_stillRunning = m_timers.find(p_job.timer);
+        if (l_stillRunning != m_timers.end()) {
+            l_stillRunning->second.task = std::move(l_task);
+        }
+    };
+    try {
+        l_task();
+    } catch (...) {
+        l_restore();
+        throw;
+    }
+    l_restore();
+    return true;
+}
+
+} // namespace Snake
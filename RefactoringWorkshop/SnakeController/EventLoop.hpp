@@ -0,0 +1,112 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <queue>
+#include <unordered_map>
+#include <vector>
+
+#include "ControllerMetrics.hpp"
+
+class Event;
+class IEventHandler;
+
+namespace Snake
+{
+
+// Single-threaded executor: runs posted tasks, event deliveries and timers
+// one at a time on the thread that calls runOnce() or runUntil(), so that
+// any number of handlers can wait for events without a thread each.
+// Posting and timer calls are meant to come from that thread too, e.g.
+// from within a task.
+//
+// Scheduling latency, the time from when a job became due (its posting,
+// or its timer's due time) to when it started running, is recorded for
+// every job.
+class EventLoop
+{
+public:
+    using Clock = std::chrono::steady_clock;
+    using TimerId = std::uint64_t;
+
+    // p_now is the time source and p_sleepUntil waits on it while there is
+    // nothing to do; tests pass a manual clock and a sleep that advances it.
+    explicit EventLoop(std::function<Clock::time_point()> p_now = &Clock::now,
+                       std::function<void(Clock::time_point)> p_sleepUntil = &EventLoop::sleepUntil);
+    ~EventLoop();
+
+    EventLoop(EventLoop const&) = delete;
+    EventLoop& operator=(EventLoop const&) = delete;
+
+    Clock::time_point now() const { return m_now(); }
+
+    void post(std::function<void()> p_task);
+    void post(IEventHandler& p_handler, std::unique_ptr<Event> p_evt);
+
+    // Runs p_task once at p_due, or at p_due and then every p_period.
+    // Periodic timers do not drift: the next due time is counted from the
+    // previous one, not from when the task ran. A timer that fell behind
+    // by more than a period runs once and skips the periods it missed.
+    TimerId startTimer(Clock::time_point p_due, std::function<void()> p_task);
+    TimerId startTimer(Clock::time_point p_due, Clock::duration p_period, std::function<void()> p_task);
+
+    // Returns false for a timer that already ran out or was cancelled.
+    bool cancelTimer(TimerId p_id);
+
+    // Runs the jobs that are due now, those posted meanwhile excluded, and
+    // returns how many ran. Exceptions from a job propagate; the remaining
+    // jobs stay queued.
+    std::size_t runOnce();
+
+    // Runs jobs as they become due until p_deadline, sleeping while there
+    // is nothing to do.
+    void runUntil(Clock::time_point p_deadline);
+
+    std::size_t readyCount() const { return m_ready.size(); }
+    std::size_t timerCount() const { return m_timers.size(); }
+
+    LatencyHistogram const& schedulingLatency() const { return m_schedulingLatency; }
+    void resetSchedulingLatency() { m_schedulingLatency = LatencyHistogram(); }
+
+private:
+    struct Job
+    {
+        Clock::time_point due;
+        TimerId timer;                  // 0 for a posted job
+        std::function<void()> task;
+        IEventHandler* handler;
+        std::unique_ptr<Event> evt;
+    };
+
+    struct Timer
+    {
+        Clock::duration period;         // zero for a one-shot timer
+        std::function<void()> task;
+    };
+
+    struct DueTimer
+    {
+        Clock::time_point due;
+        TimerId id;
+
+        bool operator>(DueTimer const& p_rhs) const { return due > p_rhs.due; }
+    };
+
+    static void sleepUntil(Clock::time_point p_wakeUp);
+
+    void collectDueTimers(Clock::time_point p_now);
+    bool run(Job& p_job, Clock::time_point p_start);
+
+    std::function<Clock::time_point()> m_now;
+    std::function<void(Clock::time_point)> m_sleepUntil;
+    std::deque<Job> m_ready;
+    std::priority_queue<DueTimer, std::vector<DueTimer>, std::greater<DueTimer>> m_dueTimers;
+    std::unordered_map<TimerId, Timer> m_timers;
+    TimerId m_lastTimerId;
+    LatencyHistogram m_schedulingLatency;
+};
+
+} // namespace Snake
@@ -0,0 +1,100 @@
+#include "FramebufferPort.hpp"
+
+#include <algorithm>
+
+#include "EventT.hpp"
+
+namespace Snake
+{
+
+constexpr int FramebufferPort::c_tileSize;
+
+FramebufferPort::FramebufferPort(int p_width, int p_height)
+    : m_width(std::max(p_width, 0)),
+      m_height(std::max(p_height, 0)),
+      m_rowWords((std::size_t(m_width) + 31) / 32),
+      m_cells(m_rowWords * std::size_t(m_height), 0),
+      m_tilesPerRow((std::size_t(m_width) + c_tileSize - 1) / c_tileSize),
+      m_tiles(m_tilesPerRow * ((std::size_t(m_height) + c_tileSize - 1) / c_tileSize), Tile())
+{}
+
+void FramebufferPort::send(std::unique_ptr<Event> p_evt)
+{
+    apply(payload<DisplayInd>(*p_evt));
+}
+
+void FramebufferPort::sendBatch(EventBatch p_events)
+{
+    for (auto const& l_evt : p_events) {
+        apply(payload<DisplayInd>(*l_evt));
+    }
+}
+
+Cell FramebufferPort::cell(int p_x, int p_y) const
+{
+    if (unsigned(p_x) >= unsigned(m_width) or unsigned(p_y) >= unsigned(m_height)) {
+        return Cell_FREE;
+    }
+    std::uint64_t const l_word = m_cells[std::size_t(p_y) * m_rowWords + std::size_t(p_x) / 32];
+    return static_cast<Cell>((l_word >> (2 * (p_x % 32))) & 0b11);
+}
+
+void FramebufferPort::apply(DisplayInd const& p_displayInd)
+{
+    int const x = p_displayInd.x;
+    int const y = p_displayInd.y;
+    if (unsigned(x) >= unsigned(m_width) or unsigned(y) >= unsigned(m_height)) {
+        return;
+    }
+
+    std::uint64_t& l_word = m_cells[std::size_t(y) * m_rowWords + std::size_t(x) / 32];
+    unsigned const l_shift = 2 * unsigned(x % 32);
+    std::uint64_t const l_value = std::uint64_t(p_displayInd.value & 0b11) << l_shift;
+    if ((l_word & (std::uint64_t(0b11) << l_shift)) == l_value) {
+        return;
+    }
+    l_word = (l_word & ~(std::uint64_t(0b11) << l_shift)) | l_value;
+
+    std::size_t const l_index = std::size_t(y / c_tileSize) * m_tilesPerRow + std::size_t(x / c_tileSize);
+    Tile& l_tile = m_tiles[l_index];
+    std::uint16_t const l_x = std::uint16_t(x % c_tileSize);
+    std::uint16_t const l_y = std::uint16_t(y % c_tileSize);
+
+    if (not l_tile.dirty) {
+        l_tile = Tile{l_x, l_y, l_x, l_y, true};
+        m_dirtyTiles.push_back(std::uint32_t(l_index));
+        return;
+    }
+    l_tile.minX = std::min(l_tile.minX, l_x);
+    l_tile.minY = std::min(l_tile.minY, l_y);
+    l_tile.maxX = std::max(l_tile.maxX, l_x);
+    l_tile.maxY = std::max(l_tile.maxY, l_y);
+}
+
+void FramebufferPort::endTick()
+{
+    m_dirtyRects.clear();
+    for (std::uint32_t const l_index : m_dirtyTiles) {
+        Tile& l_tile = m_tiles[l_index];
+        int const l_tileX = int(l_index % m_tilesPerRow) * c_tileSize;
+        int const l_tileY = int(l_index / m_tilesPerRow) * c_tileSize;
+
+        m_dirtyRects.push_back(FrameRect{l_tileX + l_tile.minX, l_tileY + l_tile.minY,
+                                         l_tile.maxX - l_tile.minX + 1, l_tile.maxY - l_tile.minY + 1});
+        l_tile.dirty = false;
+    }
+    m_dirtyTiles.clear();
+}
+
+void FramebufferPort::copyRect(FrameRect const& p_rect, std::vector<std::uint8_t>& p_out) const
+{
+    p_out.reserve(p_out.size() + std::size_t(p_rect.width) * std::size_t(p_rect.height));
+    for (int y = p_rect.y; y < p_rect.y + p_rect.height; ++y) {
+        std::uint64_t const* const l_row = &m_cells[std::size_t(y) * m_rowWords];
+        for (int x = p_rect.x; x < p_rect.x + p_rect.width; ++x) {
+            p_out.push_back(std::uint8_t((l_row[x / 32] >> (2 * (x % 32))) & 0b11));
+        }
+    }
+}
+
+} // namespace Snake
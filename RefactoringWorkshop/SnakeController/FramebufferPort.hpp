@@ -0,0 +1,92 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "IPort.hpp"
+#include "SnakeInterface.hpp"
+
+class Event;
+
+namespace Snake
+{
+
+struct FrameRect
+{
+    int x;
+    int y;
+    int width;
+    int height;
+};
+
+// Display port keeping the board a controller draws, so that a viewer
+// joining mid-game gets it without a replay. Cells take 2 bits each,
+// rows padded to whole 64-bit words: a 4096x4096 board is 4 MiB.
+//
+// Changes are tracked per tile of c_tileSize x c_tileSize cells. A tick
+// ends with endTick(); every tile changed during it then yields one
+// rectangle bounding its changed cells. The cost of a tick is that of
+// its updates and dirty tiles, whatever the size of the board. Writing
+// the value a cell already has changes nothing.
+//
+// DisplayInd outside the board are dropped; other events throw
+// std::bad_cast.
+class FramebufferPort : public IPort
+{
+public:
+    static constexpr int c_tileSize = 64;
+
+    FramebufferPort(int p_width, int p_height);
+
+    void send(std::unique_ptr<Event> p_evt) override;
+    void sendBatch(EventBatch p_events) override;
+
+    int width() const { return m_width; }
+    int height() const { return m_height; }
+
+    // Cell_FREE outside the board.
+    Cell cell(int p_x, int p_y) const;
+
+    // Makes the rectangles changed since the previous call available
+    // through dirtyRects().
+    void endTick();
+
+    // Of the last tick ended, in the order their tiles were first changed.
+    std::vector<FrameRect> const& dirtyRects() const { return m_dirtyRects; }
+
+    // Appends the cells of p_rect, which must lie on the board, row after
+    // row, one byte each.
+    void copyRect(FrameRect const& p_rect, std::vector<std::uint8_t>& p_out) const;
+
+    // The whole board as stored: row y starts at word y * rowWords(), and
+    // cell x of it is the 2 bits from bit 2 * (x % 32) of word x / 32 of
+    // the row.
+    std::vector<std::uint64_t> const& frame() const { return m_cells; }
+    std::size_t rowWords() const { return m_rowWords; }
+
+private:
+    struct Tile
+    {
+        std::uint16_t minX;
+        std::uint16_t minY;
+        std::uint16_t maxX;
+        std::uint16_t maxY;
+        bool dirty;
+    };
+
+    void apply(DisplayInd const& p_displayInd);
+
+    int m_width;
+    int m_height;
+    std::size_t m_rowWords;
+    std::vector<std::uint64_t> m_cells;
+
+    std::size_t m_tilesPerRow;
+    std::vector<Tile> m_tiles;
+    std::vector<std::uint32_t> m_dirtyTiles; // in order of their first change
+    std::vector<FrameRect> m_dirtyRects;
+};
+
+} // namespace Snake
@@ -0,0 +1,127 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <utility>
+#include <vector>
+
+namespace Snake
+{
+
+// The free cells of a map kept in a dense array, with the slot of every
+// cell kept alongside: the first freeCount() slots hold the free cells,
+// the rest the occupied ones. Occupying or releasing a cell swaps it
+// across that boundary, and a uniformly random free cell is one slot
+// away. Takes 8 bytes per cell. Coordinates outside the map are ignored.
+class FreeCellIndex
+{
+public:
+    FreeCellIndex(int p_width, int p_height)
+        : m_width(p_width),
+          m_height(p_height),
+          m_cells(std::size_t(p_width) * std::size_t(p_height)),
+          m_slots(m_cells.size()),
+          m_freeCount(m_cells.size())
+    {
+        for (std::size_t i = 0; i < m_cells.size(); ++i) {
+            m_cells[i] = static_cast<std::uint32_t>(i);
+            m_slots[i] = static_cast<std::uint32_t>(i);
+        }
+    }
+
+    // Takes the slot order saved from order(). Returns false, leaving the
+    // index unchanged, unless p_order holds every cell of the map once and
+    // its first p_freeCount slots hold exactly the cells p_isFree accepts.
+    template <class IsFree>
+    bool restore(std::vector<std::uint32_t> const& p_order, std::size_t p_freeCount, IsFree&& p_isFree)
+    {
+        if (p_order.size() != m_cells.size() or p_freeCount > m_cells.size()) {
+            return false;
+        }
+
+        std::vector<std::uint32_t> l_slots(m_cells.size(), std::uint32_t(m_cells.size()));
+        for (std::size_t l_slot = 0; l_slot < p_order.size(); ++l_slot) {
+            std::uint32_t const l_cell = p_order[l_slot];
+            if (l_cell >= m_cells.size() or l_slots[l_cell] != m_cells.size() or
+                (l_slot < p_freeCount) != p_isFree(int(l_cell % std::uint32_t(m_width)), int(l_cell / std::uint32_t(m_width)))) {
+                return false;
+            }
+            l_slots[l_cell] = static_cast<std::uint32_t>(l_slot);
+        }
+
+        m_cells = p_order;
+        m_slots = std::move(l_slots);
+        m_freeCount = p_freeCount;
+        return true;
+    }
+
+    // The cell in every slot; see restore().
+    std::vector<std::uint32_t> const& order() const { return m_cells; }
+
+    std::size_t freeCount() const { return m_freeCount; }
+
+    bool isFree(int p_x, int p_y) const
+    {
+        return contains(p_x, p_y) and m_slots[index(p_x, p_y)] < m_freeCount;
+    }
+
+    void occupy(int p_x, int p_y)
+    {
+        if (isFree(p_x, p_y)) {
+            moveTo(index(p_x, p_y), --m_freeCount);
+        }
+    }
+
+    void release(int p_x, int p_y)
+    {
+        if (contains(p_x, p_y) and not isFree(p_x, p_y)) {
+            moveTo(index(p_x, p_y), m_freeCount++);
+        }
+    }
+
+    // p_slot-th free cell, p_slot < freeCount().
+    std::pair<int, int> freeCell(std::size_t p_slot) const
+    {
+        std::uint32_t const l_cell = m_cells[p_slot];
+        return std::make_pair(int(l_cell % std::uint32_t(m_width)), int(l_cell / std::uint32_t(m_width)));
+    }
+
+    // A uniformly random free cell; there must be one.
+    template <class Random>
+    std::pair<int, int> sample(Random& p_random) const
+    {
+        return freeCell(std::uniform_int_distribution<std::size_t>(0, m_freeCount - 1)(p_random));
+    }
+
+private:
+    bool contains(int p_x, int p_y) const
+    {
+        return unsigned(p_x) < unsigned(m_width) and unsigned(p_y) < unsigned(m_height);
+    }
+
+    std::uint32_t index(int p_x, int p_y) const
+    {
+        return std::uint32_t(p_y) * std::uint32_t(m_width) + std::uint32_t(p_x);
+    }
+
+    // Swaps p_cell with the cell in p_slot.
+    void moveTo(std::uint32_t p_cell, std::size_t p_slot)
+    {
+        std::uint32_t const l_other = m_cells[p_slot];
+        std::uint32_t const l_from = m_slots[p_cell];
+
+        m_cells[l_from] = l_other;
+        m_slots[l_other] = l_from;
+        m_cells[p_slot] = p_cell;
+        m_slots[p_cell] = static_cast<std::uint32_t>(p_slot);
+    }
+
+    int m_width;
+    int m_height;
+    std::vector<std::uint32_t> m_cells; // by slot
+    std::vector<std::uint32_t> m_slots; // by cell
+    std::size_t m_freeCount;
+};
+
+} // namespace Snake
@@ -0,0 +1,286 @@
+#include "LoadGenerator.hpp"
+
+#include <exception>
+#include <ostream>
+#include <sstream>
+#include <thread>
+
+#include "Event.hpp"
+#include "EventT.hpp"
+
+namespace Snake
+{
+namespace
+{
+
+std::uint64_t nanoseconds(LoadGenerator::Clock::duration p_duration)
+{
+    return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(p_duration).count());
+}
+
+} // namespace
+
+ScriptError::ScriptError(std::size_t p_line, char const* p_reason)
+    : std::logic_error("Bad load script at line " + std::to_string(p_line) + ": " + p_reason + "."),
+      m_line(p_line)
+{}
+
+SyntheticPolicy::SyntheticPolicy(double p_tickShare, double p_directionShare, double p_foodShare, unsigned p_seed)
+    : m_random(p_seed + 1),
+      m_kind({p_tickShare, p_directionShare, p_foodShare})
+{}
+
+ControllerInput SyntheticPolicy::next(SessionInfo const& p_session)
+{
+    switch (m_kind(m_random)) {
+        case 1:
+            return DirectionInd{static_cast<Direction>(std::uniform_int_distribution<int>(0, 3)(m_random))};
+        case 2:
+            return FoodResp{std::uniform_int_distribution<int>(0, p_session.width - 1)(m_random),
+                            std::uniform_int_distribution<int>(0, p_session.height - 1)(m_random)};
+        default:
+            return TimeoutInd{};
+    }
+}
+
+ScriptedPolicy::ScriptedPolicy(std::string const& p_script)
+{
+    std::istringstream l_lines(p_script);
+    std::string l_line;
+
+    for (std::size_t l_number = 1; std::getline(l_lines, l_line); ++l_number) {
+        std::istringstream l_fields(l_line);
+        char l_kind = 0;
+        if (not (l_fields >> l_kind) or l_kind == '#') {
+            continue;
+        }
+
+        if (l_kind == 'T') {
+            m_events.push_back(TimeoutInd{});
+        } else if (l_kind == 'D') {
+            char l_direction = 0;
+            l_fields >> l_direction;
+            switch (l_direction) {
+                case 'U': m_events.push_back(DirectionInd{Direction_UP}); break;
+                case 'D': m_events.push_back(DirectionInd{Direction_DOWN}); break;
+                case 'L': m_events.push_back(DirectionInd{Direction_LEFT}); break;
+                case 'R': m_events.push_back(DirectionInd{Direction_RIGHT}); break;
+                default: throw ScriptError(l_number, "direction must be one of U, D, L, R");
+            }
+        } else if (l_kind == 'F') {
+            FoodResp l_food;
+            if (not (l_fields >> l_food.x >> l_food.y)) {
+                throw ScriptError(l_number, "food needs two coordinates");
+            }
+            m_events.push_back(l_food);
+        } else {
+            throw ScriptError(l_number, "unknown event, expected T, D or F");
+        }
+
+        std::string l_rest;
+        if (l_fields >> l_rest) {
+            throw ScriptError(l_number, "unexpected text after the event");
+        }
+    }
+
+    if (m_events.empty()) {
+        throw ScriptError(0, "script has no events");
+    }
+}
+
+ControllerInput ScriptedPolicy::next(SessionInfo const& p_session)
+{
+    return m_events[p_session.step % m_events.size()];
+}
+
+void CountingPort::send(std::unique_ptr<Event> p_evt)
+{
+    ++m_total;
+
+    std::uint32_t const l_messageId = p_evt->getMessageId();
+    for (auto& l_count : m_counts) {
+        if (l_count.first == l_messageId) {
+            ++l_count.second;
+            return;
+        }
+    }
+    m_counts.emplace_back(l_messageId, 1);
+}
+
+std::uint64_t CountingPort::count(std::uint32_t p_messageId) const
+{
+    for (auto const& l_count : m_counts) {
+        if (l_count.first == p_messageId) {
+            return l_count.second;
+        }
+    }
+    return 0;
+}
+
+void writeReport(std::ostream& p_out, LoadReport const& p_report)
+{
+    auto const l_microseconds = [](std::uint64_t p_nanoseconds) { return p_nanoseconds / 1e3; };
+    double const l_events = p_report.events ? static_cast<double>(p_report.events) : 1.0;
+
+    p_out << "events " << p_report.events << '\n'
+          << "seconds " << p_report.seconds << '\n'
+          << "events_per_second " << p_report.eventsPerSecond() << '\n'
+          << "errors " << p_report.errors << '\n'
+          << "restarts " << p_report.restarts << '\n'
+          << "latency_p50_us " << l_microseconds(p_report.latency.percentile(50)) << '\n'
+          << "latency_p99_us " << l_microseconds(p_report.latency.percentile(99)) << '\n'
+          << "latency_p999_us " << l_microseconds(p_report.latency.percentile(99.9)) << '\n'
+          << "latency_max_us " << l_microseconds(p_report.latency.max()) << '\n'
+          << "service_p50_us " << l_microseconds(p_report.service.percentile(50)) << '\n'
+          << "service_p99_us " << l_microseconds(p_report.service.percentile(99)) << '\n'
+          << "service_max_us " << l_microseconds(p_report.service.max()) << '\n'
+          << "display_inds " << p_report.displayInds << '\n'
+          << "food_reqs " << p_report.foodReqs << '\n'
+          << "score_inds " << p_report.scoreInds << '\n'
+          << "loose_inds " << p_report.looseInds << '\n'
+          << "event_heap_allocations_per_event " << p_report.eventPool.heapAllocations / l_events << '\n'
+          << "event_pool_reuses_per_event " << p_report.eventPool.reuses / l_events << '\n';
+}
+
+// Counts into the shared score sink and notes that the session lost.
+class LoadGenerator::ScorePort : public IPort
+{
+public:
+    explicit ScorePort(CountingPort& p_sink)
+        : m_sink(p_sink)
+    {}
+
+    void send(std::unique_ptr<Event> p_evt) override
+    {
+        lost = lost or p_evt->getMessageId() == LooseInd::MESSAGE_ID;
+        m_sink.send(std::move(p_evt));
+    }
+
+    bool lost = false;
+
+private:
+    CountingPort& m_sink;
+};
+
+struct LoadGenerator::Session
+{
+    Session(std::size_t p_id, std::string const& p_config, CountingPort& p_scoreSink)
+        : config(p_config),
+          scorePort(p_scoreSink),
+          info{p_id, 0, 0, 0}
+    {}
+
+    std::string const& config;
+    ScorePort scorePort;
+    std::unique_ptr<Controller> controller;
+    SessionInfo info;
+};
+
+LoadGenerator::LoadGenerator(LoadProfile p_profile, InputPolicy& p_policy,
+                             std::function<Clock::time_point()> p_now,
+                             std::function<void(Clock::time_point)> p_sleepUntil)
+    : m_profile(std::move(p_profile)),
+      m_policy(p_policy),
+      m_now(std::move(p_now)),
+      m_sleepUntil(std::move(p_sleepUntil))
+{
+    if (m_profile.sessions == 0 or m_profile.configs.empty()) {
+        throw std::invalid_argument("A load profile needs at least one session and one config.");
+    }
+
+    m_sessions.reserve(m_profile.sessions);
+    for (std::size_t i = 0; i < m_profile.sessions; ++i) {
+        m_sessions.push_back(std::make_unique<Session>(i, m_profile.configs[i % m_profile.configs.size()], m_scorePort));
+        start(*m_sessions.back());
+    }
+}
+
+LoadGenerator::~LoadGenerator() = default;
+
+void LoadGenerator::sleepUntil(Clock::time_point p_time)
+{
+    std::this_thread::sleep_until(p_time - std::chrono::microseconds(200));
+    while (Clock::now() < p_time) {
+        std::this_thread::yield();
+    }
+}
+
+void LoadGenerator::start(Session& p_session)
+{
+    p_session.controller = std::make_unique<Controller>(m_displayPort, m_foodPort, p_session.scorePort, p_session.config);
+    p_session.scorePort.lost = false;
+    p_session.info.width = p_session.controller->occupancy().width();
+    p_session.info.height = p_session.controller->occupancy().height();
+    p_session.info.step = 0;
+}
+
+void LoadGenerator::deliver(Session& p_session, ControllerInput const& p_input, LoadReport& p_report)
+{
+    try {
+        if (m_profile.typed) {
+            p_session.controller->receive(p_input);
+        } else {
+            p_session.controller->receive(p_input.toEvent());
+        }
+    } catch (std::exception const&) {
+        ++p_report.errors;
+    }
+}
+
+LoadReport LoadGenerator::run()
+{
+    LoadReport l_report;
+    std::uint64_t const l_displayInds = m_displayPort.count(DisplayInd::MESSAGE_ID);
+    std::uint64_t const l_foodReqs = m_foodPort.count(FoodReq::MESSAGE_ID);
+    std::uint64_t const l_scoreInds = m_scorePort.count(ScoreInd::MESSAGE_ID);
+    std::uint64_t const l_looseInds = m_scorePort.count(LooseInd::MESSAGE_ID);
+
+    // Events of all sessions are due one interval apart.
+    double const l_interval = m_profile.rate > 0.0 ? 1e9 / (m_profile.rate * m_profile.sessions) : 0.0;
+
+    resetEventPoolStats();
+    Clock::time_point const l_start = m_now();
+    Clock::time_point l_now = l_start;
+
+    for (std::uint64_t k = 0; m_profile.maxEvents == 0 or k < m_profile.maxEvents; ++k) {
+        Clock::time_point l_due = l_now;
+        if (l_interval > 0.0) {
+            l_due = l_start + std::chrono::nanoseconds(static_cast<std::int64_t>(k * l_interval));
+            if (l_due > l_now) {
+                m_sleepUntil(l_due);
+                l_now = m_now();
+            }
+        }
+        if (l_now - l_start >= m_profile.duration) {
+            break;
+        }
+
+        Session& l_session = *m_sessions[k % m_sessions.size()];
+        ControllerInput const l_input = m_policy.next(l_session.info);
+
+        Clock::time_point const l_begin = m_now();
+        deliver(l_session, l_input, l_report);
+        l_now = m_now();
+
+        l_report.service.record(nanoseconds(l_now - l_begin));
+        l_report.latency.record(nanoseconds(l_now - (l_interval > 0.0 ? l_due : l_begin)));
+        ++l_report.events;
+        ++l_session.info.step;
+
+        if (l_session.scorePort.lost) {
+            ++l_report.restarts;
+            start(l_session);
+            l_now = m_now();
+        }
+    }
+
+    l_report.seconds = std::chrono::duration<double>(l_now - l_start).count();
+    l_report.eventPool = eventPoolStats();
+    l_report.displayInds = m_displayPort.count(DisplayInd::MESSAGE_ID) - l_displayInds;
+    l_report.foodReqs = m_foodPort.count(FoodReq::MESSAGE_ID) - l_foodReqs;
+    l_report.scoreInds = m_scorePort.count(ScoreInd::MESSAGE_ID) - l_scoreInds;
+    l_report.looseInds = m_scorePort.count(LooseInd::MESSAGE_ID) - l_looseInds;
+    return l_report;
+}
+
+} // namespace Snake
@@ -0,0 +1,182 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iosfwd>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "ControllerMetrics.hpp"
+#include "EventPool.hpp"
+#include "IPort.hpp"
+#include "SnakeController.hpp"
+
+namespace Snake
+{
+
+struct ScriptError : std::logic_error
+{
+    ScriptError(std::size_t p_line, char const* p_reason);
+
+    // 1-based line of the script at fault.
+    std::size_t line() const { return m_line; }
+
+private:
+    std::size_t m_line;
+};
+
+// What an input policy knows about the session it feeds.
+struct SessionInfo
+{
+    std::size_t session;
+    int width;
+    int height;
+    std::uint64_t step; // events the session received since it (re)started
+};
+
+// Decides the next event a session receives.
+class InputPolicy
+{
+public:
+    virtual ~InputPolicy() = default;
+    virtual ControllerInput next(SessionInfo const& p_session) = 0;
+};
+
+// Random traffic: each event is a TimeoutInd, a DirectionInd with a random
+// direction or a FoodResp at a random cell of the map, in proportion to
+// the given shares.
+class SyntheticPolicy : public InputPolicy
+{
+public:
+    SyntheticPolicy(double p_tickShare, double p_directionShare, double p_foodShare, unsigned p_seed = 0);
+
+    ControllerInput next(SessionInfo const& p_session) override;
+
+private:
+    std::minstd_rand m_random;
+    std::discrete_distribution<int> m_kind;
+};
+
+// Plays a script, one event per line, over and over; every session has its
+// own place in it. A line is one of
+//
+//   T            TimeoutInd
+//   D U|D|L|R    DirectionInd
+//   F x y        FoodResp
+//
+// Empty lines and lines starting with # are skipped. Throws ScriptError
+// for anything else and for a script without events.
+class ScriptedPolicy : public InputPolicy
+{
+public:
+    explicit ScriptedPolicy(std::string const& p_script);
+
+    ControllerInput next(SessionInfo const& p_session) override;
+
+    std::size_t size() const { return m_events.size(); }
+
+private:
+    std::vector<ControllerInput> m_events;
+};
+
+// Sink counting what it receives, by message id.
+class CountingPort : public IPort
+{
+public:
+    void send(std::unique_ptr<Event> p_evt) override;
+
+    std::uint64_t count(std::uint32_t p_messageId) const;
+    std::uint64_t total() const { return m_total; }
+
+private:
+    std::vector<std::pair<std::uint32_t, std::uint64_t>> m_counts;
+    std::uint64_t m_total = 0;
+};
+
+struct LoadProfile
+{
+    std::size_t sessions = 1;
+    std::vector<std::string> configs; // session N plays configs[N % configs.size()]
+    double rate = 0.0;                // events per second per session, 0 for no pacing
+    std::chrono::nanoseconds duration = std::chrono::seconds(1);
+    std::uint64_t maxEvents = 0;      // stop after this many, 0 for no limit
+    bool typed = false;               // deliver ControllerInput instead of boxed Events
+};
+
+struct LoadReport
+{
+    std::uint64_t events = 0;   // delivered to controllers
+    std::uint64_t errors = 0;   // events a controller rejected with an exception
+    std::uint64_t restarts = 0; // sessions started again after a LooseInd
+    double seconds = 0.0;
+
+    // From the time an event was due to the time it was handled, so time
+    // spent falling behind the schedule counts. Without pacing an event is
+    // due when its delivery starts.
+    LatencyHistogram latency;
+    // Controller::receive() alone.
+    LatencyHistogram service;
+
+    std::uint64_t displayInds = 0;
+    std::uint64_t foodReqs = 0;
+    std::uint64_t scoreInds = 0;
+    std::uint64_t looseInds = 0;
+
+    EventPoolStats eventPool; // of the generator's thread, during the run
+
+    double eventsPerSecond() const { return seconds > 0.0 ? events / seconds : 0.0; }
+};
+
+// Writes p_report as name value lines, latencies in microseconds.
+void writeReport(std::ostream& p_out, LoadReport const& p_report);
+
+// Drives Snake::Controller sessions, on the calling thread, with events
+// chosen by an InputPolicy. Sessions take turns; with a rate the events
+// are scheduled at fixed intervals from the start, an open loop that does
+// not slow down when the controllers do. A session that sends LooseInd is
+// started again from its config.
+class LoadGenerator
+{
+public:
+    using Clock = std::chrono::steady_clock;
+
+    // Throws ConfigurationError for a bad config and std::invalid_argument
+    // for a profile without sessions or configs.
+    LoadGenerator(LoadProfile p_profile, InputPolicy& p_policy,
+                  std::function<Clock::time_point()> p_now = &Clock::now,
+                  std::function<void(Clock::time_point)> p_sleepUntil = &LoadGenerator::sleepUntil);
+    ~LoadGenerator();
+
+    // Sleeps until shortly before p_time and spins for the rest, so that
+    // oversleeping does not show up as controller latency.
+    static void sleepUntil(Clock::time_point p_time);
+
+    LoadGenerator(LoadGenerator const&) = delete;
+    LoadGenerator& operator=(LoadGenerator const&) = delete;
+
+    // Runs until the profile's duration or event limit is reached.
+    LoadReport run();
+
+private:
+    class ScorePort;
+    struct Session;
+
+    void start(Session& p_session);
+    void deliver(Session& p_session, ControllerInput const& p_input, LoadReport& p_report);
+
+    LoadProfile m_profile;
+    InputPolicy& m_policy;
+    std::function<Clock::time_point()> m_now;
+    std::function<void(Clock::time_point)> m_sleepUntil;
+
+    CountingPort m_displayPort;
+    CountingPort m_foodPort;
+    CountingPort m_scorePort;
+    std::vector<std::unique_ptr<Session>> m_sessions;
+};
+
+} // namespace Snake
@@ -0,0 +1,142 @@
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <exception>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <sstream>
+#include <string>
+
+#include "LoadGenerator.hpp"
+
+namespace
+{
+
+std::atomic<std::uint64_t> s_heapAllocations{0};
+
+} // namespace
+
+// Every heap allocation of the process, events included, is counted here.
+void* operator new(std::size_t p_size)
+{
+    s_heapAllocations.fetch_add(1, std::memory_order_relaxed);
+    if (void* l_ptr = std::malloc(p_size ? p_size : 1)) {
+        return l_ptr;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* p_ptr) noexcept
+{
+    std::free(p_ptr);
+}
+
+void operator delete(void* p_ptr, std::size_t) noexcept
+{
+    std::free(p_ptr);
+}
+
+namespace
+{
+
+char const* const c_usage =
+    "Usage: SnakeController_LOADGEN [options]\n"
+    "  --sessions N       sessions to drive (default 1000)\n"
+    "  --rate R           events per second per session, 0 for as fast as possible (default 0)\n"
+    "  --seconds S        how long to run (default 5)\n"
+    "  --events N         stop after N events, 0 for no limit (default 0)\n"
+    "  --config FILE      config template, repeat for more; sessions take them in turn\n"
+    "  --mix T,D,F        shares of TimeoutInd, DirectionInd and FoodResp (default 8,1,1)\n"
+    "  --script FILE      play the events in FILE instead of a random mix\n"
+    "  --seed N           seed of the random mix (default 0)\n"
+    "  --typed            deliver events as ControllerInput instead of boxed Events\n";
+
+char const* const c_defaultConfig = "W 64 64 F 40 40 S R 3 2 32 1 32 0 32";
+
+std::string readFile(std::string const& p_path)
+{
+    std::ifstream l_file(p_path);
+    if (not l_file) {
+        throw std::runtime_error("Cannot read " + p_path + ".");
+    }
+    return std::string(std::istreambuf_iterator<char>(l_file), std::istreambuf_iterator<char>());
+}
+
+} // namespace
+
+int main(int p_argc, char* p_argv[])
+try {
+    Snake::LoadProfile l_profile;
+    l_profile.sessions = 1000;
+    l_profile.duration = std::chrono::seconds(5);
+    double l_mix[3] = {8.0, 1.0, 1.0};
+    std::string l_script;
+    unsigned l_seed = 0;
+
+    for (int i = 1; i < p_argc; ++i) {
+        std::string const l_option = p_argv[i];
+        if (l_option == "--typed") {
+            l_profile.typed = true;
+            continue;
+        }
+        if (l_option == "--help" or i + 1 == p_argc) {
+            std::cerr << c_usage;
+            return l_option == "--help" ? 0 : 2;
+        }
+
+        std::string const l_value = p_argv[++i];
+        if (l_option == "--sessions") {
+            l_profile.sessions = std::stoul(l_value);
+        } else if (l_option == "--rate") {
+            l_profile.rate = std::stod(l_value);
+        } else if (l_option == "--seconds") {
+            l_profile.duration = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::duration<double>(std::stod(l_value)));
+        } else if (l_option == "--events") {
+            l_profile.maxEvents = std::stoull(l_value);
+        } else if (l_option == "--config") {
+            l_profile.configs.push_back(readFile(l_value));
+        } else if (l_option == "--mix") {
+            std::istringstream l_shares(l_value);
+            char l_comma;
+            if (not (l_shares >> l_mix[0] >> l_comma >> l_mix[1] >> l_comma >> l_mix[2])) {
+                std::cerr << c_usage;
+                return 2;
+            }
+        } else if (l_option == "--script") {
+            l_script = readFile(l_value);
+        } else if (l_option == "--seed") {
+            l_seed = static_cast<unsigned>(std::stoul(l_value));
+        } else {
+            std::cerr << c_usage;
+            return 2;
+        }
+    }
+    if (l_profile.configs.empty()) {
+        l_profile.configs.push_back(c_defaultConfig);
+    }
+
+    std::unique_ptr<Snake::InputPolicy> l_policy;
+    if (l_script.empty()) {
+        l_policy = std::make_unique<Snake::SyntheticPolicy>(l_mix[0], l_mix[1], l_mix[2], l_seed);
+    } else {
+        l_policy = std::make_unique<Snake::ScriptedPolicy>(l_script);
+    }
+
+    Snake::LoadGenerator l_generator(l_profile, *l_policy);
+
+    std::uint64_t const l_allocationsBefore = s_heapAllocations.load();
+    Snake::LoadReport const l_report = l_generator.run();
+    std::uint64_t const l_allocations = s_heapAllocations.load() - l_allocationsBefore;
+
+    Snake::writeReport(std::cout, l_report);
+    std::cout << "heap_allocations_per_event "
+              << (l_report.events ? double(l_allocations) / l_report.events : 0.0) << '\n';
+    return 0;
+} catch (std::exception const& p_exc) {
+    std::cerr << p_exc.what() << '\n';
+    return 1;
+}
@@ -0,0 +1,74 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Snake
+{
+
+// One bit per map cell telling whether a snake segment occupies it.
+// Coordinates outside the map are never occupied.
+class OccupancyGrid
+{
+public:
+    OccupancyGrid()
+        : OccupancyGrid(0, 0)
+    {}
+
+    OccupancyGrid(int p_width, int p_height)
+        : m_width(p_width),
+          m_height(p_height),
+          m_words((std::size_t(p_width) * std::size_t(p_height) + 63) / 64, 0)
+    {}
+
+    bool contains(int p_x, int p_y) const
+    {
+        return unsigned(p_x) < unsigned(m_width) and unsigned(p_y) < unsigned(m_height);
+    }
+
+    bool test(int p_x, int p_y) const
+    {
+        if (not contains(p_x, p_y)) {
+            return false;
+        }
+
+        auto const l_index = index(p_x, p_y);
+        return (m_words[l_index / 64] >> (l_index % 64)) & 1u;
+    }
+
+    void set(int p_x, int p_y)
+    {
+        if (contains(p_x, p_y)) {
+            auto const l_index = index(p_x, p_y);
+            m_words[l_index / 64] |= std::uint64_t(1) << (l_index % 64);
+        }
+    }
+
+    void reset(int p_x, int p_y)
+    {
+        if (contains(p_x, p_y)) {
+            auto const l_index = index(p_x, p_y);
+            m_words[l_index / 64] &= ~(std::uint64_t(1) << (l_index % 64));
+        }
+    }
+
+    int width() const { return m_width; }
+    int height() const { return m_height; }
+
+    // The bits, row after row with no padding: cell (x, y) is bit i % 64
+    // of word i / 64, i = y * width + x. Bits past the last cell are 0.
+    std::vector<std::uint64_t> const& words() const { return m_words; }
+
+private:
+    std::size_t index(int p_x, int p_y) const
+    {
+        return std::size_t(p_y) * std::size_t(m_width) + std::size_t(p_x);
+    }
+
+    int m_width;
+    int m_height;
+    std::vector<std::uint64_t> m_words;
+};
+
+} // namespace Snake
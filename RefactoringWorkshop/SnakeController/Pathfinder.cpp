@@ -0,0 +1,201 @@
+#include "Pathfinder.hpp"
+
+#include "SnakeController.hpp"
+
+namespace Snake
+{
+namespace
+{
+
+std::pair<int, int> step(std::pair<int, int> p_from, Direction p_direction)
+{
+    int const l_sign = (p_direction & 0b10) ? 1 : -1;
+    return (p_direction & 0b01) ? std::make_pair(p_from.first + l_sign, p_from.second)
+                                : std::make_pair(p_from.first, p_from.second + l_sign);
+}
+
+} // namespace
+
+constexpr std::uint32_t DistanceField::unreachable;
+constexpr int DistanceField::c_bitboardWidth;
+
+void DistanceField::compute(OccupancyGrid const& p_obstacles, int p_targetX, int p_targetY)
+{
+    m_width = p_obstacles.width();
+    m_height = p_obstacles.height();
+    m_distance.assign(std::size_t(m_width) * std::size_t(m_height), unreachable);
+
+    if (unsigned(p_targetX) >= unsigned(m_width) or unsigned(p_targetY) >= unsigned(m_height)) {
+        return;
+    }
+    m_distance[std::size_t(p_targetY) * std::size_t(m_width) + std::size_t(p_targetX)] = 0;
+
+    if (m_width <= c_bitboardWidth) {
+        searchRows(p_obstacles, p_targetX, p_targetY);
+    } else {
+        searchCells(p_obstacles, p_targetX, p_targetY);
+    }
+}
+
+void DistanceField::searchRows(OccupancyGrid const& p_obstacles, int p_targetX, int p_targetY)
+{
+    std::size_t const l_rows = std::size_t(m_height);
+    std::size_t const l_width = std::size_t(m_width);
+    std::uint64_t const l_rowMask = l_width == 64 ? ~std::uint64_t(0) : (std::uint64_t(1) << l_width) - 1;
+    std::vector<std::uint64_t> const& l_words = p_obstacles.words();
+
+    m_free.resize(l_rows);
+    for (std::size_t y = 0; y < l_rows; ++y) {
+        std::size_t const l_bit = y * l_width;
+        std::size_t const l_word = l_bit / 64;
+        unsigned const l_shift = unsigned(l_bit % 64);
+
+        std::uint64_t l_occupied = l_words[l_word] >> l_shift;
+        if (l_shift and l_word + 1 < l_words.size()) {
+            l_occupied |= l_words[l_word + 1] << (64 - l_shift);
+        }
+        m_free[y] = ~l_occupied & l_rowMask;
+    }
+
+    m_visited.assign(l_rows, 0);
+    m_frontier.assign(l_rows, 0);
+    m_candidateStep.assign(l_rows, 0);
+    m_active.clear();
+
+    auto const l_target = static_cast<std::uint32_t>(p_targetY);
+    m_frontier[l_target] = m_visited[l_target] = std::uint64_t(1) << p_targetX;
+    m_active.push_back(l_target);
+
+    for (std::uint32_t l_distance = 1; not m_active.empty(); ++l_distance) {
+        m_candidates.clear();
+        for (std::uint32_t const l_row : m_active) {
+            if (l_row) {
+                addCandidate(l_row - 1, l_distance);
+            }
+            addCandidate(l_row, l_distance);
+            if (l_row + 1 < l_rows) {
+                addCandidate(l_row + 1, l_distance);
+            }
+        }
+
+        // Every candidate reads the frontier as it was, so it is replaced
+        // only once all of them are done.
+        m_reached.resize(m_candidates.size());
+        for (std::size_t i = 0; i < m_candidates.size(); ++i) {
+            std::uint32_t const l_row = m_candidates[i];
+            std::uint64_t const l_here = m_frontier[l_row];
+            std::uint64_t l_spread = l_here << 1 | l_here >> 1;
+            if (l_row) {
+                l_spread |= m_frontier[l_row - 1];
+            }
+            if (l_row + 1 < l_rows) {
+                l_spread |= m_frontier[l_row + 1];
+            }
+            m_reached[i] = l_spread & m_free[l_row] & ~m_visited[l_row];
+        }
+
+        for (std::uint32_t const l_row : m_active) {
+            m_frontier[l_row] = 0;
+        }
+        m_active.clear();
+
+        for (std::size_t i = 0; i < m_candidates.size(); ++i) {
+            if (m_reached[i]) {
+                std::uint32_t const l_row = m_candidates[i];
+                m_frontier[l_row] = m_reached[i];
+                m_visited[l_row] |= m_reached[i];
+                record(l_row, m_reached[i], l_distance);
+                m_active.push_back(l_row);
+            }
+        }
+    }
+}
+
+void DistanceField::addCandidate(std::uint32_t p_row, std::uint32_t p_step)
+{
+    if (m_candidateStep[p_row] != p_step) {
+        m_candidateStep[p_row] = p_step;
+        m_candidates.push_back(p_row);
+    }
+}
+
+void DistanceField::record(std::uint32_t p_row, std::uint64_t p_cells, std::uint32_t p_distance)
+{
+    std::uint32_t* const l_distance = &m_distance[std::size_t(p_row) * std::size_t(m_width)];
+
+    for (; p_cells; p_cells &= p_cells - 1) {
+        l_distance[__builtin_ctzll(p_cells)] = p_distance;
+    }
+}
+
+void DistanceField::searchCells(OccupancyGrid const& p_obstacles, int p_targetX, int p_targetY)
+{
+    m_queue.clear();
+    m_queue.push_back(std::uint32_t(p_targetY) * std::uint32_t(m_width) + std::uint32_t(p_targetX));
+
+    for (std::size_t i = 0; i < m_queue.size(); ++i) {
+        std::uint32_t const l_cell = m_queue[i];
+        int const x = int(l_cell % std::uint32_t(m_width));
+        int const y = int(l_cell / std::uint32_t(m_width));
+        std::uint32_t const l_next = m_distance[l_cell] + 1;
+
+        int const l_neighbours[4][2] = {{x - 1, y}, {x + 1, y}, {x, y - 1}, {x, y + 1}};
+        for (auto const& l_neighbour : l_neighbours) {
+            int const l_x = l_neighbour[0];
+            int const l_y = l_neighbour[1];
+            if (not p_obstacles.contains(l_x, l_y) or p_obstacles.test(l_x, l_y)) {
+                continue;
+            }
+            std::uint32_t const l_index = std::uint32_t(l_y) * std::uint32_t(m_width) + std::uint32_t(l_x);
+            if (m_distance[l_index] == unreachable) {
+                m_distance[l_index] = l_next;
+                m_queue.push_back(l_index);
+            }
+        }
+    }
+}
+
+DistanceField const& Pathfinder::field(OccupancyGrid const& p_board, std::pair<int, int> p_food)
+{
+    m_field.compute(p_board, p_food.first, p_food.second);
+    return m_field;
+}
+
+Direction Pathfinder::nextDirection(OccupancyGrid const& p_board, std::pair<int, int> p_head, Direction p_current,
+                                    std::pair<int, int> p_food)
+{
+    return nextDirection(field(p_board, p_food), p_board, p_head, p_current);
+}
+
+Direction Pathfinder::nextDirection(DistanceField const& p_field, OccupancyGrid const& p_board,
+                                    std::pair<int, int> p_head, Direction p_current)
+{
+    // Turning flips the axis bit; both turns keep the head off its neck.
+    Direction const l_turn = static_cast<Direction>((p_current ^ 0b01) & 0b01);
+    Direction const l_moves[] = {p_current, l_turn, static_cast<Direction>(l_turn | 0b10)};
+
+    Direction l_best = p_current;
+    std::uint32_t l_bestDistance = DistanceField::unreachable;
+    bool l_bestIsSafe = false;
+
+    for (Direction const l_move : l_moves) {
+        std::pair<int, int> const l_cell = step(p_head, l_move);
+        bool const l_safe = p_board.contains(l_cell.first, l_cell.second) and not p_board.test(l_cell.first, l_cell.second);
+        std::uint32_t const l_distance = l_safe ? p_field.distance(l_cell.first, l_cell.second) : DistanceField::unreachable;
+
+        if (l_distance < l_bestDistance or (l_safe and not l_bestIsSafe)) {
+            l_best = l_move;
+            l_bestDistance = l_distance;
+            l_bestIsSafe = l_safe;
+        }
+    }
+    return l_best;
+}
+
+Direction Pathfinder::nextDirection(Controller const& p_controller)
+{
+    return nextDirection(p_controller.occupancy(), p_controller.head(), p_controller.direction(),
+                         p_controller.foodPosition());
+}
+
+} // namespace Snake
@@ -0,0 +1,97 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "OccupancyGrid.hpp"
+#include "SnakeInterface.hpp"
+
+namespace Snake
+{
+class Controller;
+
+// Number of moves from every cell of a map to a target cell, going only
+// through cells not set in the obstacle grid.
+//
+// On maps up to 64 cells wide the search is a breadth-first search over
+// bitboards: a row is one 64-bit word, and one step of the search advances
+// the frontier of a row at once with shifts and masks. Only the rows the
+// frontier is on, and their neighbours, are visited in a step. On wider
+// maps a frontier, diamond shaped on open ground, has a cell or two per
+// word, so bitboards stop paying for themselves; there the search goes a
+// cell at a time through a queue.
+class DistanceField
+{
+public:
+    static constexpr std::uint32_t unreachable = ~std::uint32_t(0);
+    static constexpr int c_bitboardWidth = 64;
+
+    // The target counts as free even when an obstacle covers it. A target
+    // outside the map leaves every cell unreachable.
+    void compute(OccupancyGrid const& p_obstacles, int p_targetX, int p_targetY);
+
+    // unreachable outside the map.
+    std::uint32_t distance(int p_x, int p_y) const
+    {
+        if (unsigned(p_x) >= unsigned(m_width) or unsigned(p_y) >= unsigned(m_height)) {
+            return unreachable;
+        }
+        return m_distance[std::size_t(p_y) * std::size_t(m_width) + std::size_t(p_x)];
+    }
+
+    int width() const { return m_width; }
+    int height() const { return m_height; }
+
+private:
+    void searchRows(OccupancyGrid const& p_obstacles, int p_targetX, int p_targetY);
+    void searchCells(OccupancyGrid const& p_obstacles, int p_targetX, int p_targetY);
+    void addCandidate(std::uint32_t p_row, std::uint32_t p_step);
+    void record(std::uint32_t p_row, std::uint64_t p_cells, std::uint32_t p_distance);
+
+    int m_width = 0;
+    int m_height = 0;
+    std::vector<std::uint32_t> m_distance;
+
+    // searchRows(), by row.
+    std::vector<std::uint64_t> m_free;
+    std::vector<std::uint64_t> m_visited;
+    std::vector<std::uint64_t> m_frontier;      // 0 outside of m_active
+    std::vector<std::uint32_t> m_candidateStep; // the last step the row was a candidate in
+    std::vector<std::uint32_t> m_active;        // rows with frontier cells
+    std::vector<std::uint32_t> m_candidates;    // rows the next step may reach
+    std::vector<std::uint64_t> m_reached;       // by candidate: the cells it reaches
+
+    // searchCells(): cells in order of distance.
+    std::vector<std::uint32_t> m_queue;
+};
+
+// Steers computer-controlled players towards the food. Keeps one distance
+// field, computed anew from the food on every call, so that its buffers
+// are reused from one decision to the next. Sharing a field between
+// players is left to the caller: players on one board can compute it once
+// with field() and decide with the static nextDirection(). Every
+// Controller has a board of its own, so nothing here shares one.
+class Pathfinder
+{
+public:
+    DistanceField const& field(OccupancyGrid const& p_board, std::pair<int, int> p_food);
+
+    // The move bringing the head closest to the food, among the ones
+    // Controller accepts: straight on or a turn. Prefers going straight on
+    // a tie. When the food cannot be reached, takes any move that does not
+    // hit something, and goes straight on when there is none.
+    Direction nextDirection(OccupancyGrid const& p_board, std::pair<int, int> p_head, Direction p_current,
+                            std::pair<int, int> p_food);
+    Direction nextDirection(Controller const& p_controller);
+
+    // The same, with p_field computed from the food on p_board.
+    static Direction nextDirection(DistanceField const& p_field, OccupancyGrid const& p_board,
+                                   std::pair<int, int> p_head, Direction p_current);
+
+private:
+    DistanceField m_field;
+};
+
+} // namespace Snake
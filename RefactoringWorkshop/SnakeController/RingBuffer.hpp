@@ -0,0 +1,87 @@
+#pragma once
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace Snake
+{
+
+// Double-ended queue over one contiguous power-of-two sized array. Index 0
+// is the front. Storage only grows; popping never frees memory.
+template <class T>
+class RingBuffer
+{
+public:
+    bool empty() const { return m_size == 0; }
+    std::size_t size() const { return m_size; }
+    std::size_t capacity() const { return m_items.size(); }
+
+    T& operator[](std::size_t p_index) { return m_items[slot(p_index)]; }
+    T const& operator[](std::size_t p_index) const { return m_items[slot(p_index)]; }
+
+    T& front() { return m_items[m_first]; }
+    T const& front() const { return m_items[m_first]; }
+    T& back() { return (*this)[m_size - 1]; }
+    T const& back() const { return (*this)[m_size - 1]; }
+
+    void push_front(T const& p_item)
+    {
+        if (m_size == m_items.size()) {
+            grow();
+        }
+        m_first = (m_first + m_items.size() - 1) & mask();
+        m_items[m_first] = p_item;
+        ++m_size;
+    }
+
+    void push_back(T const& p_item)
+    {
+        if (m_size == m_items.size()) {
+            grow();
+        }
+        m_items[slot(m_size)] = p_item;
+        ++m_size;
+    }
+
+    void pop_front()
+    {
+        m_first = (m_first + 1) & mask();
+        --m_size;
+    }
+
+    void pop_back() { --m_size; }
+
+    void clear()
+    {
+        m_first = 0;
+        m_size = 0;
+    }
+
+    void reserve(std::size_t p_capacity)
+    {
+        while (m_items.size() < p_capacity) {
+            grow();
+        }
+    }
+
+private:
+    std::size_t mask() const { return m_items.size() - 1; }
+    std::size_t slot(std::size_t p_index) const { return (m_first + p_index) & mask(); }
+
+    void grow()
+    {
+        std::vector<T> l_items(m_items.empty() ? 8 : 2 * m_items.size());
+        for (std::size_t i = 0; i < m_size; ++i) {
+            l_items[i] = std::move((*this)[i]);
+        }
+        m_items.swap(l_items);
+        m_first = 0;
+    }
+
+    std::vector<T> m_items;
+    std::size_t m_first = 0;
+    std::size_t m_size = 0;
+};
+
+} // namespace Snake
@@ -0,0 +1,289 @@
+#include "SessionManager.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstring>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+
+#include "EventT.hpp"
+#include "SnakeController.hpp"
+
+namespace Snake
+{
+
+class SessionManager::Shard
+{
+public:
+    Shard(SessionId p_firstId, std::size_t p_idStride)
+        : m_firstId(p_firstId),
+          m_idStride(p_idStride),
+          m_ticks(0),
+          m_events(0),
+          m_errors(0),
+          m_stopping(false),
+          m_busy(false),
+          m_worker([this] { run(); })
+    {}
+
+    ~Shard()
+    {
+        {
+            std::lock_guard<std::mutex> l_lock(m_mutex);
+            m_stopping = true;
+        }
+        m_wakeUp.notify_one();
+        m_worker.join();
+    }
+
+    void adopt(std::unique_ptr<Controller> p_controller)
+    {
+        Job l_job;
+        l_job.kind = Job::Adopt;
+        l_job.controller = std::move(p_controller);
+        push(std::move(l_job));
+    }
+
+    void deliver(std::size_t p_local, std::unique_ptr<Event> p_evt)
+    {
+        Job l_job;
+        l_job.kind = Job::Deliver;
+        l_job.local = p_local;
+        l_job.evt = std::move(p_evt);
+        push(std::move(l_job));
+    }
+
+    void tick()
+    {
+        Job l_job;
+        l_job.kind = Job::Tick;
+        push(std::move(l_job));
+    }
+
+    void snapshot(std::vector<unsigned char>& p_out)
+    {
+        Job l_job;
+        l_job.kind = Job::Snapshot;
+        l_job.snapshot = &p_out;
+        push(std::move(l_job));
+        waitIdle();
+    }
+
+    void waitIdle()
+    {
+        std::unique_lock<std::mutex> l_lock(m_mutex);
+        m_idle.wait(l_lock, [this] { return m_queue.empty() and not m_busy; });
+    }
+
+    std::uint64_t ticks() const { return m_ticks.load(std::memory_order_relaxed); }
+    std::uint64_t events() const { return m_events.load(std::memory_order_relaxed); }
+    std::uint64_t errors() const { return m_errors.load(std::memory_order_relaxed); }
+
+private:
+    struct Job
+    {
+        enum Kind { Adopt, Deliver, Tick, Snapshot } kind;
+        std::size_t local = 0;
+        std::unique_ptr<Event> evt;
+        std::unique_ptr<Controller> controller;
+        std::vector<unsigned char>* snapshot = nullptr;
+    };
+
+    void push(Job p_job)
+    {
+        bool l_wasEmpty;
+        {
+            std::lock_guard<std::mutex> l_lock(m_mutex);
+            l_wasEmpty = m_queue.empty();
+            m_queue.push_back(std::move(p_job));
+        }
+        if (l_wasEmpty) {
+            m_wakeUp.notify_one();
+        }
+    }
+
+    void run()
+    {
+        std::vector<Job> l_jobs;
+
+        while (true) {
+            {
+                std::unique_lock<std::mutex> l_lock(m_mutex);
+                m_busy = false;
+                if (m_queue.empty()) {
+                    m_idle.notify_all();
+                }
+                m_wakeUp.wait(l_lock, [this] { return m_stopping or not m_queue.empty(); });
+                if (m_queue.empty()) {
+                    return;
+                }
+                m_busy = true;
+                l_jobs.swap(m_queue);
+            }
+
+            for (auto& l_job : l_jobs) {
+                execute(l_job);
+            }
+            l_jobs.clear();
+        }
+    }
+
+    void execute(Job& p_job)
+    {
+        switch (p_job.kind) {
+            case Job::Adopt:
+                m_sessions.push_back(std::move(p_job.controller));
+                break;
+            case Job::Deliver:
+                m_events.fetch_add(1, std::memory_order_relaxed);
+                receive(*m_sessions[p_job.local], std::move(p_job.evt));
+                break;
+            case Job::Tick:
+                for (auto& l_session : m_sessions) {
+                    receive(*l_session, std::make_unique<EventT<TimeoutInd>>());
+                }
+                m_ticks.fetch_add(m_sessions.size(), std::memory_order_relaxed);
+                break;
+            case Job::Snapshot:
+                for (std::size_t i = 0; i < m_sessions.size(); ++i) {
+                    std::uint64_t const l_session = m_firstId + i * m_idStride;
+                    auto const* l_bytes = reinterpret_cast<unsigned char const*>(&l_session);
+                    p_job.snapshot->insert(p_job.snapshot->end(), l_bytes, l_bytes + sizeof(l_session));
+                    m_sessions[i]->snapshot(*p_job.snapshot);
+                }
+                break;
+        }
+    }
+
+    void receive(Controller& p_session, std::unique_ptr<Event> p_evt)
+    {
+        try {
+            p_session.receive(std::move(p_evt));
+        } catch (std::exception&) {
+            m_errors.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    SessionId const m_firstId;
+    std::size_t const m_idStride;
+    std::vector<std::unique_ptr<Controller>> m_sessions; // worker thread only
+
+    std::atomic<std::uint64_t> m_ticks;
+    std::atomic<std::uint64_t> m_events;
+    std::atomic<std::uint64_t> m_errors;
+
+    std::mutex m_mutex;
+    std::condition_variable m_wakeUp;
+    std::condition_variable m_idle;
+    std::vector<Job> m_queue;
+    bool m_stopping;
+    bool m_busy;
+
+    std::thread m_worker;
+};
+
+SessionManager::SessionManager(std::size_t p_shardCount)
+    : m_sessionCount(0),
+      m_startTime(std::chrono::steady_clock::now())
+{
+    for (std::size_t i = 0; i < std::max<std::size_t>(p_shardCount, 1); ++i) {
+        m_shards.push_back(std::make_unique<Shard>(i, std::max<std::size_t>(p_shardCount, 1)));
+    }
+}
+
+SessionManager::~SessionManager() = default;
+
+SessionManager::SessionId SessionManager::createSession(
+    IPort& p_displayPort, IPort& p_foodPort, IPort& p_scorePort, std::string const& p_config)
+{
+    return adopt(std::make_unique<Controller>(p_displayPort, p_foodPort, p_scorePort, p_config));
+}
+
+SessionManager::SessionId SessionManager::createSession(
+    IPort& p_displayPort, IPort& p_foodPort, IPort& p_scorePort, BinaryConfig p_config)
+{
+    return adopt(std::make_unique<Controller>(p_displayPort, p_foodPort, p_scorePort, p_config));
+}
+
+SessionManager::SessionId SessionManager::createSession(
+    IPort& p_displayPort, IPort& p_foodPort, IPort& p_scorePort, ControllerSnapshot p_snapshot)
+{
+    return adopt(std::make_unique<Controller>(p_displayPort, p_foodPort, p_scorePort, p_snapshot));
+}
+
+SessionManager::SessionId SessionManager::adopt(std::unique_ptr<Controller> p_controller)
+{
+    SessionId const l_id = m_sessionCount++;
+    m_shards[l_id % m_shards.size()]->adopt(std::move(p_controller));
+    return l_id;
+}
+
+void SessionManager::post(SessionId p_session, std::unique_ptr<Event> p_evt)
+{
+    if (p_session >= m_sessionCount) {
+        throw std::out_of_range("Unknown Snake session.");
+    }
+
+    m_shards[p_session % m_shards.size()]->deliver(p_session / m_shards.size(), std::move(p_evt));
+}
+
+void SessionManager::snapshotShard(std::size_t p_shard, std::vector<unsigned char>& p_out)
+{
+    m_shards.at(p_shard)->snapshot(p_out);
+}
+
+void SessionManager::tick()
+{
+    for (auto& l_shard : m_shards) {
+        l_shard->tick();
+    }
+}
+
+void SessionManager::waitIdle()
+{
+    for (auto& l_shard : m_shards) {
+        l_shard->waitIdle();
+    }
+}
+
+EngineStats SessionManager::stats() const
+{
+    EngineStats l_stats;
+    for (auto const& l_shard : m_shards) {
+        l_stats.ticks += l_shard->ticks();
+        l_stats.events += l_shard->events();
+        l_stats.errors += l_shard->errors();
+    }
+    l_stats.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - m_startTime).count();
+    return l_stats;
+}
+
+std::vector<ShardSnapshotRecord> splitShardSnapshot(unsigned char const* p_data, std::size_t p_size)
+{
+    std::vector<ShardSnapshotRecord> l_records;
+    std::size_t l_offset = 0;
+
+    while (l_offset < p_size) {
+        ShardSnapshotRecord l_record;
+        SnapshotHeader l_header;
+        if (p_size - l_offset < sizeof(l_record.session) + sizeof(l_header)) {
+            throw ConfigurationError(l_offset, "shard snapshot is truncated");
+        }
+
+        std::memcpy(&l_record.session, p_data + l_offset, sizeof(l_record.session));
+        l_offset += sizeof(l_record.session);
+        std::memcpy(&l_header, p_data + l_offset, sizeof(l_header));
+        if (l_header.size < sizeof(l_header) or p_size - l_offset < l_header.size) {
+            throw ConfigurationError(l_offset, "shard snapshot is truncated");
+        }
+
+        l_record.state = ControllerSnapshot{p_data + l_offset, l_header.size};
+        l_offset += l_header.size;
+        l_records.push_back(l_record);
+    }
+    return l_records;
+}
+
+} // namespace Snake
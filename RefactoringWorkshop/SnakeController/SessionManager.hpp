@@ -0,0 +1,98 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "ConfigReader.hpp"
+#include "ControllerSnapshot.hpp"
+
+class Event;
+class IPort;
+
+namespace Snake
+{
+class Controller;
+
+struct EngineStats
+{
+    std::uint64_t ticks = 0;  // TimeoutInd deliveries to controllers
+    std::uint64_t events = 0; // other events delivered through post()
+    std::uint64_t errors = 0; // events a controller rejected with an exception
+    double seconds = 0.0;     // since the manager was created
+
+    double ticksPerSecond() const { return seconds > 0.0 ? ticks / seconds : 0.0; }
+};
+
+// Record of a shard snapshot: the session id followed by the session's
+// ControllerSnapshot, whose header tells its size.
+struct ShardSnapshotRecord
+{
+    std::uint64_t session;
+    ControllerSnapshot state;
+};
+
+// Splits the output of SessionManager::snapshotShard() into its records.
+// The records point into p_data.
+std::vector<ShardSnapshotRecord> splitShardSnapshot(unsigned char const* p_data, std::size_t p_size);
+
+// Owns many Snake::Controller sessions and runs them on a fixed pool of
+// worker threads, one per shard. Session id N lives on shard
+// N % shardCount and everything addressed to it is executed by that
+// shard's thread, in the order it was posted. A session's ports are only
+// ever called from its shard thread.
+//
+// createSession(), post() and tick() are meant to be called from a single
+// control thread.
+class SessionManager
+{
+public:
+    using SessionId = std::size_t;
+
+    explicit SessionManager(std::size_t p_shardCount);
+    ~SessionManager();
+
+    SessionManager(SessionManager const&) = delete;
+    SessionManager& operator=(SessionManager const&) = delete;
+
+    // Throws ConfigurationError in the calling thread for a bad config.
+    SessionId createSession(IPort& p_displayPort, IPort& p_foodPort, IPort& p_scorePort, std::string const& p_config);
+    SessionId createSession(IPort& p_displayPort, IPort& p_foodPort, IPort& p_scorePort, BinaryConfig p_config);
+
+    // Continues the game saved in p_snapshot as a new session of this
+    // manager; see Controller::snapshot().
+    SessionId createSession(IPort& p_displayPort, IPort& p_foodPort, IPort& p_scorePort, ControllerSnapshot p_snapshot);
+
+    void post(SessionId p_session, std::unique_ptr<Event> p_evt);
+
+    // Queues one TimeoutInd broadcast per shard; each shard delivers it to
+    // all of its sessions.
+    void tick();
+
+    // Blocks until every shard has executed everything queued so far.
+    void waitIdle();
+
+    // Appends a ShardSnapshotRecord for every session of p_shard, taken by
+    // the shard thread once everything queued before has been executed,
+    // and blocks until done.
+    void snapshotShard(std::size_t p_shard, std::vector<unsigned char>& p_out);
+
+    EngineStats stats() const;
+
+    std::size_t shardCount() const { return m_shards.size(); }
+    std::size_t sessionCount() const { return m_sessionCount; }
+
+private:
+    class Shard;
+
+    SessionId adopt(std::unique_ptr<Controller> p_controller);
+
+    std::vector<std::unique_ptr<Shard>> m_shards;
+    std::size_t m_sessionCount;
+    std::chrono::steady_clock::time_point m_startTime;
+};
+
+} // namespace Snake
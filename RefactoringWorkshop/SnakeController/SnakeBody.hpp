@@ -0,0 +1,78 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "ConfigReader.hpp"
+#include "OccupancyGrid.hpp"
+#include "RingBuffer.hpp"
+
+namespace Snake
+{
+
+// A segment is freed once the age of its snake, the number of ticks that
+// aged the body, reaches its expiry.
+struct SnakeSegment
+{
+    int x;
+    int y;
+    std::int64_t expiry;
+};
+
+// Reads a config through p_reader into an empty body at age 0, head at
+// index 0 of p_segments, and marks its cells in p_occupancy. Throws
+// ConfigurationError, with the offset of the item at fault, for a snake
+// that does not fit in the map or whose segments leave the map or overlap.
+template <class Reader>
+ConfigHeader readSnake(Reader& p_reader, RingBuffer<SnakeSegment>& p_segments, OccupancyGrid& p_occupancy)
+{
+    ConfigHeader const l_header = p_reader.readHeader();
+    if (l_header.length > static_cast<long long>(l_header.width) * l_header.height) {
+        throw ConfigurationError(p_reader.position(), "snake does not fit in the map");
+    }
+
+    p_occupancy = OccupancyGrid(l_header.width, l_header.height);
+    p_segments.reserve(static_cast<std::size_t>(l_header.length));
+
+    for (int length = l_header.length; length; --length) {
+        std::size_t const l_position = p_reader.position();
+
+        SnakeSegment seg;
+        p_reader.readSegment(seg.x, seg.y);
+        seg.expiry = length;
+
+        if (not p_occupancy.contains(seg.x, seg.y)) {
+            throw ConfigurationError(l_position, "segment outside the map");
+        }
+        if (p_occupancy.test(seg.x, seg.y)) {
+            throw ConfigurationError(l_position, "segment overlaps another one");
+        }
+
+        p_occupancy.set(seg.x, seg.y);
+        p_segments.push_back(seg);
+    }
+    return l_header;
+}
+
+// Removes the segments that have expired at p_age, passing each of them to
+// p_free first. Expiries never increase from head to tail, so they are a
+// suffix of the body; they are freed in head-to-tail order.
+template <class Free>
+void expireSegments(RingBuffer<SnakeSegment>& p_segments, std::int64_t p_age, Free&& p_free)
+{
+    std::size_t expired = 0;
+    while (expired < p_segments.size() and
+           p_segments[p_segments.size() - 1 - expired].expiry <= p_age) {
+        ++expired;
+    }
+
+    for (std::size_t i = p_segments.size() - expired; i < p_segments.size(); ++i) {
+        p_free(p_segments[i]);
+    }
+
+    while (expired--) {
+        p_segments.pop_back();
+    }
+}
+
+} // namespace Snake
@@ -1,16 +1,72 @@
 #include "SnakeController.hpp"
 
-#include <algorithm>
+#include <cstddef>
+#include <cstring>
 #include <sstream>
 
+#ifdef SNAKE_CONTROLLER_METRICS
+#include <chrono>
+#endif
+
 #include "EventT.hpp"
 #include "IPort.hpp"
 
 namespace Snake
 {
-ConfigurationError::ConfigurationError()
-    : std::logic_error("Bad configuration of Snake::Controller.")
-{}
+namespace
+{
+
+// The standard engines only show their state through a stream.
+std::uint32_t engineState(std::minstd_rand const& p_random)
+{
+    std::ostringstream l_out;
+    l_out << p_random;
+    return static_cast<std::uint32_t>(std::stoul(l_out.str()));
+}
+
+} // namespace
+
+#ifdef SNAKE_CONTROLLER_METRICS
+namespace
+{
+
+// Records the time from its construction to its destruction, also when
+// left by an exception. A receive latency is looked up only then: the
+// event handled may have re-entered receive() and added histograms.
+class LatencyScope
+{
+public:
+    explicit LatencyScope(LatencyHistogram& p_histogram)
+        : m_histogram(&p_histogram),
+          m_metrics(nullptr),
+          m_messageId(0),
+          m_start(std::chrono::steady_clock::now())
+    {}
+
+    LatencyScope(ControllerMetrics& p_metrics, std::uint32_t p_messageId)
+        : m_histogram(nullptr),
+          m_metrics(&p_metrics),
+          m_messageId(p_messageId),
+          m_start(std::chrono::steady_clock::now())
+    {}
+
+    ~LatencyScope()
+    {
+        auto const l_elapsed = std::chrono::steady_clock::now() - m_start;
+        LatencyHistogram& l_histogram = m_histogram ? *m_histogram : m_metrics->receiveLatency(m_messageId);
+        l_histogram.record(static_cast<std::uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(l_elapsed).count()));
+    }
+
+private:
+    LatencyHistogram* m_histogram;
+    ControllerMetrics* m_metrics;
+    std::uint32_t m_messageId;
+    std::chrono::steady_clock::time_point m_start;
+};
+
+} // namespace
+#endif
 
 UnexpectedEventException::UnexpectedEventException()
     : std::runtime_error("Unexpected event received!")
@@ -19,177 +75,428 @@ UnexpectedEventException::UnexpectedEventException()
 Controller::Controller(IPort& p_displayPort, IPort& p_foodPort, IPort& p_scorePort, std::string const& p_config)
     : m_displayPort(p_displayPort),
       m_foodPort(p_foodPort),
-      m_scorePort(p_scorePort)
-{
-    std::istringstream istr(p_config);
-    char w, f, s, d;
-
-    int width, height, length;
-    int foodX, foodY;
-    istr >> w >> width >> height >> f >> foodX >> foodY >> s;
-
-    if (w == 'W' and f == 'F' and s == 'S') {
-        m_mapDimension = std::make_pair(width, height);
-        m_foodPosition = std::make_pair(foodX, foodY);
-
-        istr >> d;
-        switch (d) {
-            case 'U':
-                m_currentDirection = Direction_UP;
-                break;
-            case 'D':
-                m_currentDirection = Direction_DOWN;
-                break;
-            case 'L':
-                m_currentDirection = Direction_LEFT;
-                break;
-            case 'R':
-                m_currentDirection = Direction_RIGHT;
-                break;
-            default:
-                throw ConfigurationError();
-        }
-        istr >> length;
+      m_scorePort(p_scorePort),
+      m_age(0),
+      m_publisher(nullptr)
+{
+    TextConfigReader l_reader(p_config);
+    configure(l_reader);
+}
 
-        while (length) {
-            Segment seg;
-            istr >> seg.x >> seg.y;
-            seg.ttl = length--;
+Controller::Controller(IPort& p_displayPort, IPort& p_foodPort, IPort& p_scorePort, BinaryConfig p_config)
+    : m_displayPort(p_displayPort),
+      m_foodPort(p_foodPort),
+      m_scorePort(p_scorePort),
+      m_age(0),
+      m_publisher(nullptr)
+{
+    BinaryConfigReader l_reader(p_config);
+    configure(l_reader);
+}
 
-            m_segments.push_back(seg);
-        }
-    } else {
-        throw ConfigurationError();
+template <class Reader>
+void Controller::configure(Reader& p_reader)
+{
+    ConfigHeader const l_header = readSnake(p_reader, m_segments, m_occupancy);
+
+    m_mapDimension = std::make_pair(l_header.width, l_header.height);
+    m_foodPosition = std::make_pair(l_header.foodX, l_header.foodY);
+    m_currentDirection = l_header.direction;
+}
+
+Controller::Controller(IPort& p_displayPort, IPort& p_foodPort, IPort& p_scorePort, ControllerSnapshot p_snapshot)
+    : m_displayPort(p_displayPort),
+      m_foodPort(p_foodPort),
+      m_scorePort(p_scorePort),
+      m_age(0),
+      m_publisher(nullptr)
+{
+    restore(p_snapshot);
+}
+
+Controller::~Controller() = default;
+
+void Controller::snapshot(std::vector<unsigned char>& p_out) const
+{
+    std::size_t const l_orderSize = m_freeCells ? m_freeCells->order().size() * sizeof(std::uint32_t) : 0;
+
+    SnapshotHeader l_header;
+    l_header.magic = snapshotMagic;
+    l_header.size = static_cast<std::uint32_t>(sizeof(SnapshotHeader) + m_segments.size() * sizeof(SnapshotSegment)
+                                               + l_orderSize);
+    l_header.width = m_mapDimension.first;
+    l_header.height = m_mapDimension.second;
+    l_header.foodX = m_foodPosition.first;
+    l_header.foodY = m_foodPosition.second;
+    l_header.direction = m_currentDirection;
+    l_header.length = static_cast<std::uint32_t>(m_segments.size());
+    l_header.age = m_age;
+    l_header.flags = m_freeCells ? snapshotRelocatesFood : 0;
+    l_header.random = m_freeCells ? engineState(m_random) : 0;
+
+    std::size_t l_offset = p_out.size();
+    p_out.resize(l_offset + l_header.size);
+    std::memcpy(&p_out[l_offset], &l_header, sizeof(l_header));
+    l_offset += sizeof(l_header);
+
+    for (std::size_t i = 0; i < m_segments.size(); ++i) {
+        SnapshotSegment const l_segment = {m_segments[i].x, m_segments[i].y, m_segments[i].expiry};
+        std::memcpy(&p_out[l_offset], &l_segment, sizeof(l_segment));
+        l_offset += sizeof(l_segment);
+    }
+
+    if (l_orderSize) {
+        std::memcpy(&p_out[l_offset], m_freeCells->order().data(), l_orderSize);
     }
 }
 
-void Controller::receive(std::unique_ptr<Event> e)
+void Controller::restore(ControllerSnapshot p_snapshot)
 {
-    try {
-        auto const& timerEvent = *dynamic_cast<EventT<TimeoutInd> const&>(*e);
+    SnapshotHeader l_header;
+    if (p_snapshot.size < sizeof(l_header)) {
+        throw ConfigurationError(0, "snapshot is truncated");
+    }
+    std::memcpy(&l_header, p_snapshot.data, sizeof(l_header));
 
-        Segment const& currentHead = m_segments.front();
+    if (l_header.magic != snapshotMagic) {
+        throw ConfigurationError(offsetof(SnapshotHeader, magic), "not a controller snapshot");
+    }
+    if (l_header.width <= 0 or l_header.height <= 0) {
+        throw ConfigurationError(offsetof(SnapshotHeader, width), "map dimensions must be positive");
+    }
+    if (l_header.flags & ~snapshotRelocatesFood) {
+        throw ConfigurationError(offsetof(SnapshotHeader, flags), "unknown snapshot flags");
+    }
+    bool const l_relocates = l_header.flags & snapshotRelocatesFood;
+    std::uint64_t const l_cells = std::uint64_t(l_header.width) * std::uint64_t(l_header.height);
+    std::uint64_t const l_orderSize = l_relocates ? l_cells * sizeof(std::uint32_t) : 0;
+    if (l_header.size != sizeof(l_header) + std::uint64_t(l_header.length) * sizeof(SnapshotSegment) + l_orderSize or
+        l_header.size > p_snapshot.size) {
+        throw ConfigurationError(offsetof(SnapshotHeader, size), "snapshot size does not match its length");
+    }
+    if (l_relocates and (l_header.random == 0 or l_header.random >= std::minstd_rand::modulus)) {
+        throw ConfigurationError(offsetof(SnapshotHeader, random), "food relocation engine state out of range");
+    }
+    if (l_header.direction < Direction_UP or l_header.direction > Direction_RIGHT) {
+        throw ConfigurationError(offsetof(SnapshotHeader, direction), "unknown direction");
+    }
+    if (l_header.length == 0 or l_header.length > static_cast<long long>(l_header.width) * l_header.height) {
+        throw ConfigurationError(offsetof(SnapshotHeader, length), "snake length does not fit the map");
+    }
 
-        Segment newHead;
-        newHead.x = currentHead.x + ((m_currentDirection & 0b01) ? (m_currentDirection & 0b10) ? 1 : -1 : 0);
-        newHead.y = currentHead.y + (not (m_currentDirection & 0b01) ? (m_currentDirection & 0b10) ? 1 : -1 : 0);
-        newHead.ttl = currentHead.ttl;
+    m_mapDimension = std::make_pair(l_header.width, l_header.height);
+    m_occupancy = OccupancyGrid(l_header.width, l_header.height);
+    m_foodPosition = std::make_pair(l_header.foodX, l_header.foodY);
+    m_currentDirection = static_cast<Direction>(l_header.direction);
+    m_age = l_header.age;
+    m_segments.reserve(l_header.length);
 
-        bool lost = false;
+    std::size_t l_offset = sizeof(l_header);
+    for (std::uint32_t i = 0; i < l_header.length; ++i, l_offset += sizeof(SnapshotSegment)) {
+        SnapshotSegment l_segment;
+        std::memcpy(&l_segment, p_snapshot.data + l_offset, sizeof(l_segment));
 
-        for (auto segment : m_segments) {
-            if (segment.x == newHead.x and segment.y == newHead.y) {
-                m_scorePort.send(std::make_unique<EventT<LooseInd>>());
-                lost = true;
-                break;
-            }
+        if (not m_occupancy.contains(l_segment.x, l_segment.y) or m_occupancy.test(l_segment.x, l_segment.y)) {
+            throw ConfigurationError(l_offset, "segment outside the map or overlapping another one");
+        }
+        // ageSegments() relies on expiries never increasing towards the tail.
+        if (l_segment.expiry <= m_age or (i and l_segment.expiry > m_segments.back().expiry)) {
+            throw ConfigurationError(l_offset + offsetof(SnapshotSegment, expiry), "segment expiry out of order");
         }
 
-        if (not lost) {
-            if (std::make_pair(newHead.x, newHead.y) == m_foodPosition) {
-                m_scorePort.send(std::make_unique<EventT<ScoreInd>>());
-                m_foodPort.send(std::make_unique<EventT<FoodReq>>());
-            } else if (newHead.x < 0 or newHead.y < 0 or
-                       newHead.x >= m_mapDimension.first or
-                       newHead.y >= m_mapDimension.second) {
-                m_scorePort.send(std::make_unique<EventT<LooseInd>>());
-                lost = true;
-            } else {
-                for (auto &segment : m_segments) {
-                    if (not --segment.ttl) {
-                        DisplayInd l_evt;
-                        l_evt.x = segment.x;
-                        l_evt.y = segment.y;
-                        l_evt.value = Cell_FREE;
-
-                        m_displayPort.send(std::make_unique<EventT<DisplayInd>>(l_evt));
-                    }
-                }
-            }
+        occupy(l_segment.x, l_segment.y);
+        m_segments.push_back(Segment{l_segment.x, l_segment.y, l_segment.expiry});
+    }
+
+    if (l_relocates) {
+        std::vector<std::uint32_t> l_order(static_cast<std::size_t>(l_cells));
+        std::memcpy(l_order.data(), p_snapshot.data + l_offset, static_cast<std::size_t>(l_orderSize));
+
+        m_freeCells = std::make_unique<FreeCellIndex>(l_header.width, l_header.height);
+        if (not m_freeCells->restore(l_order, l_order.size() - m_segments.size(),
+                                     [this](int p_x, int p_y) { return not m_occupancy.test(p_x, p_y); })) {
+            throw ConfigurationError(l_offset, "free cell order does not match the map");
         }
+        m_random.seed(l_header.random);
+    }
+}
+
+void Controller::relocateCollidingFood(unsigned p_seed)
+{
+    m_freeCells = std::make_unique<FreeCellIndex>(m_mapDimension.first, m_mapDimension.second);
+    for (std::size_t i = 0; i < m_segments.size(); ++i) {
+        m_freeCells->occupy(m_segments[i].x, m_segments[i].y);
+    }
+    m_random.seed(p_seed + 1);
+}
+
+void Controller::occupy(int p_x, int p_y)
+{
+    m_occupancy.set(p_x, p_y);
+    if (m_freeCells) {
+        m_freeCells->occupy(p_x, p_y);
+    }
+}
+
+void Controller::release(int p_x, int p_y)
+{
+    m_occupancy.reset(p_x, p_y);
+    if (m_freeCells) {
+        m_freeCells->release(p_x, p_y);
+    }
+}
 
-        if (not lost) {
-            m_segments.push_front(newHead);
-            DisplayInd placeNewHead;
-            placeNewHead.x = newHead.x;
-            placeNewHead.y = newHead.y;
-            placeNewHead.value = Cell_SNAKE;
-
-            m_displayPort.send(std::make_unique<EventT<DisplayInd>>(placeNewHead));
-
-            m_segments.erase(
-                std::remove_if(
-                    m_segments.begin(),
-                    m_segments.end(),
-                    [](auto const& segment){ return not (segment.ttl > 0); }),
-                m_segments.end());
+void Controller::publishBoard(BoardPublisher* p_publisher)
+{
+    if (p_publisher and
+        std::make_pair(p_publisher->width(), p_publisher->height()) != m_mapDimension) {
+        throw std::invalid_argument("Board publisher does not match the map of Snake::Controller.");
+    }
+
+    m_publisher = p_publisher;
+    if (m_publisher) {
+        m_publisher->clear();
+        m_publisher->draw(m_foodPosition.first, m_foodPosition.second, Cell_FOOD);
+        for (std::size_t i = 0; i < m_segments.size(); ++i) {
+            m_publisher->draw(m_segments[i].x, m_segments[i].y, Cell_SNAKE);
         }
-    } catch (std::bad_cast&) {
-        try {
-            auto direction = dynamic_cast<EventT<DirectionInd> const&>(*e)->direction;
-
-            if ((m_currentDirection & 0b01) != (direction & 0b01)) {
-                m_currentDirection = direction;
-            }
-        } catch (std::bad_cast&) {
-            try {
-                auto receivedFood = *dynamic_cast<EventT<FoodInd> const&>(*e);
-
-                bool requestedFoodCollidedWithSnake = false;
-                for (auto const& segment : m_segments) {
-                    if (segment.x == receivedFood.x and segment.y == receivedFood.y) {
-                        requestedFoodCollidedWithSnake = true;
-                        break;
-                    }
-                }
-
-                if (requestedFoodCollidedWithSnake) {
-                    m_foodPort.send(std::make_unique<EventT<FoodReq>>());
-                } else {
-                    DisplayInd clearOldFood;
-                    clearOldFood.x = m_foodPosition.first;
-                    clearOldFood.y = m_foodPosition.second;
-                    clearOldFood.value = Cell_FREE;
-                    m_displayPort.send(std::make_unique<EventT<DisplayInd>>(clearOldFood));
-
-                    DisplayInd placeNewFood;
-                    placeNewFood.x = receivedFood.x;
-                    placeNewFood.y = receivedFood.y;
-                    placeNewFood.value = Cell_FOOD;
-                    m_displayPort.send(std::make_unique<EventT<DisplayInd>>(placeNewFood));
-                }
-
-                m_foodPosition = std::make_pair(receivedFood.x, receivedFood.y);
-
-            } catch (std::bad_cast&) {
-                try {
-                    auto requestedFood = *dynamic_cast<EventT<FoodResp> const&>(*e);
-
-                    bool requestedFoodCollidedWithSnake = false;
-                    for (auto const& segment : m_segments) {
-                        if (segment.x == requestedFood.x and segment.y == requestedFood.y) {
-                            requestedFoodCollidedWithSnake = true;
-                            break;
-                        }
-                    }
-
-                    if (requestedFoodCollidedWithSnake) {
-                        m_foodPort.send(std::make_unique<EventT<FoodReq>>());
-                    } else {
-                        DisplayInd placeNewFood;
-                        placeNewFood.x = requestedFood.x;
-                        placeNewFood.y = requestedFood.y;
-                        placeNewFood.value = Cell_FOOD;
-                        m_displayPort.send(std::make_unique<EventT<DisplayInd>>(placeNewFood));
-                    }
-
-                    m_foodPosition = std::make_pair(requestedFood.x, requestedFood.y);
-                } catch (std::bad_cast&) {
-                    throw UnexpectedEventException();
-                }
-            }
+        m_publishedStatus = boardStatus();
+        m_publisher->publish(m_publishedStatus);
+    }
+}
+
+// Also publishes an event that drew nothing but changed the status, e.g.
+// the direction; that costs a few words per copy of the board.
+void Controller::publishChanges(bool p_drawn)
+{
+    if (not m_publisher) {
+        return;
+    }
+
+    BoardStatus const l_status = boardStatus();
+    if (p_drawn or std::memcmp(&l_status, &m_publishedStatus, sizeof(l_status))) {
+        m_publishedStatus = l_status;
+        m_publisher->publish(l_status);
+    }
+}
+
+BoardStatus Controller::boardStatus() const
+{
+    BoardStatus l_status;
+    l_status.headX = m_segments.front().x;
+    l_status.headY = m_segments.front().y;
+    l_status.foodX = m_foodPosition.first;
+    l_status.foodY = m_foodPosition.second;
+    l_status.direction = m_currentDirection;
+    l_status.length = static_cast<std::uint32_t>(m_segments.size());
+    l_status.age = m_age;
+    return l_status;
+}
+
+bool Controller::relocateFood(int& p_x, int& p_y)
+{
+    if (not m_freeCells or not m_freeCells->freeCount()) {
+        return false;
+    }
+
+    std::pair<int, int> const l_cell = m_freeCells->sample(m_random);
+    p_x = l_cell.first;
+    p_y = l_cell.second;
+    return true;
+}
+
+EventDispatcher<Controller> const& Controller::dispatcher()
+{
+    static EventDispatcher<Controller> const s_dispatcher = [] {
+        EventDispatcher<Controller> l_dispatcher;
+        l_dispatcher.registerHandler<TimeoutInd, &Controller::handleTimeoutInd>();
+        l_dispatcher.registerHandler<DirectionInd, &Controller::handleDirectionInd>();
+        l_dispatcher.registerHandler<FoodInd, &Controller::handleFoodInd>();
+        l_dispatcher.registerHandler<FoodResp, &Controller::handleFoodResp>();
+        return l_dispatcher;
+    }();
+
+    return s_dispatcher;
+}
+
+void Controller::receive(std::unique_ptr<Event> e)
+{
+#ifdef SNAKE_CONTROLLER_METRICS
+    LatencyScope l_latency(m_metrics, e->getMessageId());
+#endif
+    m_displayBatch.clear();
+
+    if (not dispatcher().dispatch(*this, *e)) {
+        throw UnexpectedEventException();
+    }
+
+    bool const l_drawn = not m_displayBatch.empty();
+    if (l_drawn) {
+        flushDisplay();
+        m_displayBatch.clear();
+    }
+    publishChanges(l_drawn);
+}
+
+struct Controller::InputVisitor
+{
+    void operator()(TimeoutInd const& p_evt) const { controller.handleTimeoutInd(p_evt); }
+    void operator()(DirectionInd const& p_evt) const { controller.handleDirectionInd(p_evt); }
+    void operator()(FoodInd const& p_evt) const { controller.handleFoodInd(p_evt); }
+    void operator()(FoodResp const& p_evt) const { controller.handleFoodResp(p_evt); }
+
+    Controller& controller;
+};
+
+void Controller::receive(ControllerInput const& p_evt)
+{
+#ifdef SNAKE_CONTROLLER_METRICS
+    LatencyScope l_latency(m_metrics, p_evt.getMessageId());
+#endif
+    m_displayBatch.clear();
+
+    p_evt.visit(InputVisitor{*this});
+
+    bool const l_drawn = not m_displayBatch.empty();
+    if (l_drawn) {
+        flushDisplay();
+        m_displayBatch.clear();
+    }
+    publishChanges(l_drawn);
+}
+
+void Controller::send(IPort& p_port, std::unique_ptr<Event> p_evt)
+{
+#ifdef SNAKE_CONTROLLER_METRICS
+    LatencyScope l_latency(m_metrics.portSendLatency);
+#endif
+    p_port.send(std::move(p_evt));
+}
+
+void Controller::flushDisplay()
+{
+#ifdef SNAKE_CONTROLLER_METRICS
+    LatencyScope l_latency(m_metrics.portSendLatency);
+#endif
+    m_displayPort.sendBatch(EventBatch{m_displayBatch.data(), m_displayBatch.size()});
+}
+
+void Controller::display(DisplayInd const& p_displayInd)
+{
+    if (m_publisher) {
+        m_publisher->draw(p_displayInd.x, p_displayInd.y, p_displayInd.value);
+    }
+    m_displayBatch.push_back(std::make_unique<EventT<DisplayInd>>(p_displayInd));
+}
+
+void Controller::handleTimeoutInd(TimeoutInd const&)
+{
+    Segment const currentHead = m_segments.front();
+    std::int64_t const headTtl = currentHead.expiry - m_age;
+
+    Segment newHead;
+    newHead.x = currentHead.x + ((m_currentDirection & 0b01) ? (m_currentDirection & 0b10) ? 1 : -1 : 0);
+    newHead.y = currentHead.y + (not (m_currentDirection & 0b01) ? (m_currentDirection & 0b10) ? 1 : -1 : 0);
+
+    bool lost = false;
+
+    if (m_occupancy.test(newHead.x, newHead.y)) {
+        send(m_scorePort, std::make_unique<EventT<LooseInd>>());
+        lost = true;
+    }
+
+    if (not lost) {
+        if (std::make_pair(newHead.x, newHead.y) == m_foodPosition) {
+            send(m_scorePort, std::make_unique<EventT<ScoreInd>>());
+            send(m_foodPort, std::make_unique<EventT<FoodReq>>());
+        } else if (newHead.x < 0 or newHead.y < 0 or
+                   newHead.x >= m_mapDimension.first or
+                   newHead.y >= m_mapDimension.second) {
+            send(m_scorePort, std::make_unique<EventT<LooseInd>>());
+            lost = true;
+        } else {
+            ageSegments();
         }
     }
+
+    if (not lost) {
+        newHead.expiry = m_age + headTtl;
+        m_segments.push_front(newHead);
+        occupy(newHead.x, newHead.y);
+        DisplayInd placeNewHead;
+        placeNewHead.x = newHead.x;
+        placeNewHead.y = newHead.y;
+        placeNewHead.value = Cell_SNAKE;
+
+        display(placeNewHead);
+    }
+}
+
+void Controller::ageSegments()
+{
+    ++m_age;
+
+    expireSegments(m_segments, m_age, [this](Segment const& p_segment) {
+        release(p_segment.x, p_segment.y);
+
+        DisplayInd l_evt;
+        l_evt.x = p_segment.x;
+        l_evt.y = p_segment.y;
+        l_evt.value = Cell_FREE;
+
+        display(l_evt);
+    });
+}
+
+void Controller::handleDirectionInd(DirectionInd const& p_directionInd)
+{
+    auto direction = p_directionInd.direction;
+
+    if ((m_currentDirection & 0b01) != (direction & 0b01)) {
+        m_currentDirection = direction;
+    }
+}
+
+void Controller::handleFoodInd(FoodInd const& p_receivedFood)
+{
+    FoodInd l_food = p_receivedFood;
+    bool requestedFoodCollidedWithSnake = m_occupancy.test(l_food.x, l_food.y) and not relocateFood(l_food.x, l_food.y);
+
+    if (requestedFoodCollidedWithSnake) {
+        send(m_foodPort, std::make_unique<EventT<FoodReq>>());
+    } else {
+        DisplayInd clearOldFood;
+        clearOldFood.x = m_foodPosition.first;
+        clearOldFood.y = m_foodPosition.second;
+        clearOldFood.value = Cell_FREE;
+        display(clearOldFood);
+
+        DisplayInd placeNewFood;
+        placeNewFood.x = l_food.x;
+        placeNewFood.y = l_food.y;
+        placeNewFood.value = Cell_FOOD;
+        display(placeNewFood);
+    }
+
+    m_foodPosition = std::make_pair(l_food.x, l_food.y);
+}
+
+void Controller::handleFoodResp(FoodResp const& p_requestedFood)
+{
+    FoodResp l_food = p_requestedFood;
+    bool requestedFoodCollidedWithSnake = m_occupancy.test(l_food.x, l_food.y) and not relocateFood(l_food.x, l_food.y);
+
+    if (requestedFoodCollidedWithSnake) {
+        send(m_foodPort, std::make_unique<EventT<FoodReq>>());
+    } else {
+        DisplayInd placeNewFood;
+        placeNewFood.x = l_food.x;
+        placeNewFood.y = l_food.y;
+        placeNewFood.value = Cell_FOOD;
+        display(placeNewFood);
+    }
+
+    m_foodPosition = std::make_pair(l_food.x, l_food.y);
 }
 
 } // namespace Snake
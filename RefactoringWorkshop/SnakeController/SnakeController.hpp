@@ -1,43 +1,119 @@
 #pragma once
 
-#include <list>
+#include <cstdint>
 #include <memory>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
 
+#include "BoardPublisher.hpp"
+#include "ConfigReader.hpp"
+#include "ControllerSnapshot.hpp"
+#include "EventDispatcher.hpp"
+#include "FreeCellIndex.hpp"
 #include "IEventHandler.hpp"
+#include "OccupancyGrid.hpp"
+#include "RingBuffer.hpp"
+#include "SnakeBody.hpp"
 #include "SnakeInterface.hpp"
+#include "TypedPort.hpp"
+
+#ifdef SNAKE_CONTROLLER_METRICS
+#include "ControllerMetrics.hpp"
+#endif
 
 class Event;
 class IPort;
 
 namespace Snake
 {
-struct ConfigurationError : std::logic_error
-{
-    ConfigurationError();
-};
 
 struct UnexpectedEventException : std::runtime_error
 {
     UnexpectedEventException();
 };
 
-class Controller : public IEventHandler
+// The closed set of events a Controller reacts to.
+using ControllerInput = TypedEvent<TimeoutInd, DirectionInd, FoodInd, FoodResp>;
+
+class Controller : public IEventHandler,
+                   public ITypedEventHandler<TimeoutInd, DirectionInd, FoodInd, FoodResp>
 {
 public:
     Controller(IPort& p_displayPort, IPort& p_foodPort, IPort& p_scorePort, std::string const& p_config);
+    Controller(IPort& p_displayPort, IPort& p_foodPort, IPort& p_scorePort, BinaryConfig p_config);
+
+    // Restores the game state saved by snapshot(). Throws
+    // ConfigurationError, with the offset of the field at fault, for a
+    // snapshot that does not describe a valid game.
+    Controller(IPort& p_displayPort, IPort& p_foodPort, IPort& p_scorePort, ControllerSnapshot p_snapshot);
+
+    ~Controller();
 
     Controller(Controller const& p_rhs) = delete;
     Controller& operator=(Controller const& p_rhs) = delete;
 
     void receive(std::unique_ptr<Event> e) override;
+    void receive(ControllerInput const& p_evt) override;
+
+    // Appends a snapshot of the game state to p_out. After
+    // relocateCollidingFood() it also holds the relocation state, so that
+    // a restored game places food as the original would, at 4 more bytes
+    // per cell of the map.
+    void snapshot(std::vector<unsigned char>& p_out) const;
+
+    // Read-only view of the game, e.g. for a computer-controlled player.
+    OccupancyGrid const& occupancy() const { return m_occupancy; }
+    std::pair<int, int> head() const { return std::make_pair(m_segments.front().x, m_segments.front().y); }
+    std::pair<int, int> foodPosition() const { return m_foodPosition; }
+    Direction direction() const { return m_currentDirection; }
+
+    // From now on, food that lands on the snake is moved to a random free
+    // cell instead of being requested again with FoodReq; only a full map
+    // still sends one. Keeps a FreeCellIndex of the map, 8 bytes per cell.
+    void relocateCollidingFood(unsigned p_seed = 0);
+
+    // From now on, the board is published to p_publisher for readers on
+    // other threads: whole now, then after each event that changes the
+    // game, with the cells it drew, so the cost of an event does not grow
+    // with the snake.
+    // nullptr stops it. Throws std::invalid_argument when p_publisher is
+    // not the size of the map. p_publisher must outlive the controller or
+    // the next call.
+    void publishBoard(BoardPublisher* p_publisher);
+
+#ifdef SNAKE_CONTROLLER_METRICS
+    // Not synchronized: call on the thread that runs receive().
+    ControllerMetrics metrics() const { return m_metrics; }
+    void resetMetrics() { m_metrics = ControllerMetrics(); }
+#endif
 
 private:
-    struct Segment
-    {
-        int x;
-        int y;
-        int ttl;
-    };
+    struct InputVisitor;
+
+    static EventDispatcher<Controller> const& dispatcher();
+
+    template <class Reader>
+    void configure(Reader& p_reader);
+    void restore(ControllerSnapshot p_snapshot);
+
+    void handleTimeoutInd(TimeoutInd const&);
+    void handleDirectionInd(DirectionInd const& p_directionInd);
+    void handleFoodInd(FoodInd const& p_receivedFood);
+    void handleFoodResp(FoodResp const& p_requestedFood);
+
+    bool relocateFood(int& p_x, int& p_y);
+    void occupy(int p_x, int p_y);
+    void release(int p_x, int p_y);
+    void ageSegments();
+    void display(DisplayInd const& p_displayInd);
+    void send(IPort& p_port, std::unique_ptr<Event> p_evt);
+    void flushDisplay();
+    BoardStatus boardStatus() const;
+    void publishChanges(bool p_drawn);
+
+    using Segment = SnakeSegment;
 
     IPort& m_displayPort;
     IPort& m_foodPort;
@@ -47,7 +123,23 @@ private:
     std::pair<int, int> m_foodPosition;
 
     Direction m_currentDirection;
-    std::list<Segment> m_segments;
+    // A segment is freed once m_age, the number of ticks that aged the
+    // body, reaches its expiry. The head is at index 0.
+    std::int64_t m_age;
+    RingBuffer<Segment> m_segments;
+    OccupancyGrid m_occupancy;
+    // Only after relocateCollidingFood().
+    std::unique_ptr<FreeCellIndex> m_freeCells;
+    std::minstd_rand m_random;
+
+    std::vector<std::unique_ptr<Event>> m_displayBatch;
+
+    BoardPublisher* m_publisher;
+    BoardStatus m_publishedStatus;
+
+#ifdef SNAKE_CONTROLLER_METRICS
+    ControllerMetrics m_metrics;
+#endif
 };
 
 } // namespace Snake
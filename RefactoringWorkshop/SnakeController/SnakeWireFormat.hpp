@@ -0,0 +1,19 @@
+#pragma once
+
+#include "SnakeInterface.hpp"
+#include "WireFormat.hpp"
+
+namespace Snake
+{
+
+using WireCodec = ::WireCodec<
+    DirectionInd,
+    TimeoutInd,
+    DisplayInd,
+    FoodInd,
+    FoodReq,
+    FoodResp,
+    ScoreInd,
+    LooseInd>;
+
+} // namespace Snake
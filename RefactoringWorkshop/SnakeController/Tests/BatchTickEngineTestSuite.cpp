@@ -0,0 +1,181 @@
+#include "BatchTickEngine.hpp"
+
+#include <random>
+#include <string>
+#include <vector>
+
+#include "EventT.hpp"
+#include "SnakeController.hpp"
+#include "SnakeWireFormat.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace ::testing;
+
+namespace Snake
+{
+namespace
+{
+
+struct WirePort : IPort
+{
+    void send(std::unique_ptr<Event> p_evt) override { WireCodec::encode(*p_evt, bytes); }
+
+    std::vector<unsigned char> bytes;
+};
+
+struct GamePorts
+{
+    WirePort display;
+    WirePort food;
+    WirePort score;
+};
+
+// A game played both by a Controller and by the engine.
+struct DifferentialGame
+{
+    GamePorts expected;
+    GamePorts actual;
+    std::unique_ptr<Controller> controller;
+    BatchTickEngine::GameId game;
+};
+
+// Horizontal snake with the tail to the left of its head, in a random
+// sized map with food anywhere on it or just outside of it.
+std::string randomConfig(std::mt19937& p_random)
+{
+    auto const l_between = [&p_random](int p_min, int p_max) {
+        return std::uniform_int_distribution<int>(p_min, p_max)(p_random);
+    };
+    char const l_directions[] = {'U', 'D', 'L', 'R'};
+
+    int const l_width = l_between(3, 12);
+    int const l_height = l_between(1, 12);
+    int const l_length = l_between(1, l_width);
+    int const l_x = l_between(l_length - 1, l_width - 1);
+    int const l_y = l_between(0, l_height - 1);
+
+    std::string l_config = "W " + std::to_string(l_width) + " " + std::to_string(l_height)
+        + " F " + std::to_string(l_between(-1, l_width)) + " " + std::to_string(l_between(-1, l_height))
+        + " S " + l_directions[l_between(0, 3)] + " " + std::to_string(l_length);
+    for (int i = 0; i < l_length; ++i) {
+        l_config += " " + std::to_string(l_x - i) + " " + std::to_string(l_y);
+    }
+    return l_config;
+}
+
+} // namespace
+
+struct BatchTickEngineTest : Test
+{
+    BatchTickEngine sut;
+};
+
+TEST_F(BatchTickEngineTest, test_BadConfig_Throws)
+{
+    GamePorts l_ports;
+
+    EXPECT_THROW(sut.addGame(l_ports.display, l_ports.food, l_ports.score, "W 2 2 F 0 0 S R 1 5 5"),
+                 ConfigurationError);
+    EXPECT_EQ(0u, sut.size());
+}
+
+TEST_F(BatchTickEngineTest, test_TickWithoutGames_DoesNothing)
+{
+    sut.tick();
+
+    EXPECT_EQ(0u, sut.size());
+}
+
+TEST_F(BatchTickEngineTest, test_Tick_MovesEveryGame)
+{
+    GamePorts l_ports[2];
+    sut.addGame(l_ports[0].display, l_ports[0].food, l_ports[0].score, "W 10 10 F 5 1 S R 2 3 1 2 1");
+    sut.addGame(l_ports[1].display, l_ports[1].food, l_ports[1].score, "W 10 10 F 5 5 S U 1 3 0");
+
+    sut.tick();
+
+    std::vector<unsigned char> l_expected;
+    WireCodec::encode(EventT<DisplayInd>(DisplayInd{2, 1, Cell_FREE}), l_expected);
+    WireCodec::encode(EventT<DisplayInd>(DisplayInd{4, 1, Cell_SNAKE}), l_expected);
+    EXPECT_EQ(l_expected, l_ports[0].display.bytes);
+
+    l_expected.clear();
+    WireCodec::encode(EventT<LooseInd>(), l_expected);
+    EXPECT_EQ(l_expected, l_ports[1].score.bytes);
+    EXPECT_TRUE(l_ports[1].display.bytes.empty());
+}
+
+TEST_F(BatchTickEngineTest, test_EatingFood_Grows)
+{
+    GamePorts l_ports;
+    auto const l_game = sut.addGame(l_ports.display, l_ports.food, l_ports.score, "W 10 10 F 4 1 S R 2 3 1 2 1");
+
+    sut.tick();
+
+    EXPECT_EQ(3u, sut.length(l_game));
+    EXPECT_FALSE(l_ports.food.bytes.empty());
+}
+
+// Random games and random inputs, the output of each game compared byte
+// for byte with a Controller fed the same inputs.
+TEST_F(BatchTickEngineTest, test_MatchesController)
+{
+    std::mt19937 l_random(2016);
+    auto const l_between = [&l_random](int p_min, int p_max) {
+        return std::uniform_int_distribution<int>(p_min, p_max)(l_random);
+    };
+    Direction const l_directions[] = {Direction_UP, Direction_DOWN, Direction_LEFT, Direction_RIGHT};
+
+    std::vector<std::unique_ptr<DifferentialGame>> l_games;
+    for (int i = 0; i < 64; ++i) {
+        std::string const l_config = randomConfig(l_random);
+        auto l_game = std::make_unique<DifferentialGame>();
+        l_game->controller = std::make_unique<Controller>(
+            l_game->expected.display, l_game->expected.food, l_game->expected.score, l_config);
+        l_game->game = sut.addGame(l_game->actual.display, l_game->actual.food, l_game->actual.score, l_config);
+        l_games.push_back(std::move(l_game));
+    }
+
+    for (int l_step = 0; l_step < 200; ++l_step) {
+        for (auto const& l_game : l_games) {
+            int const l_x = l_between(-1, 12);
+            int const l_y = l_between(-1, 12);
+            ControllerInput l_input = TimeoutInd{};
+
+            switch (l_between(0, 9)) {
+                case 0:
+                case 1:
+                case 2:
+                    l_input = DirectionInd{l_directions[l_between(0, 3)]};
+                    break;
+                case 3:
+                    l_input = FoodInd{l_x, l_y};
+                    break;
+                case 4:
+                    l_input = FoodResp{l_x, l_y};
+                    break;
+                case 5:
+                    break;
+                default:
+                    continue;
+            }
+            l_game->controller->receive(l_input);
+            sut.receive(l_game->game, l_input);
+        }
+
+        for (auto const& l_game : l_games) {
+            l_game->controller->receive(ControllerInput(TimeoutInd{}));
+        }
+        sut.tick();
+    }
+
+    for (auto const& l_game : l_games) {
+        SCOPED_TRACE("game " + std::to_string(l_game->game));
+        EXPECT_EQ(l_game->expected.display.bytes, l_game->actual.display.bytes);
+        EXPECT_EQ(l_game->expected.food.bytes, l_game->actual.food.bytes);
+        EXPECT_EQ(l_game->expected.score.bytes, l_game->actual.score.bytes);
+    }
+}
+
+} // namespace Snake
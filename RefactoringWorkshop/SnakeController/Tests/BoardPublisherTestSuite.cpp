@@ -0,0 +1,181 @@
+#include "BoardPublisher.hpp"
+
+#include <atomic>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "EventT.hpp"
+#include "SnakeController.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace ::testing;
+
+namespace Snake
+{
+namespace
+{
+
+struct NullPort : IPort
+{
+    void send(std::unique_ptr<Event>) override {}
+};
+
+BoardStatus statusOfAge(std::int64_t p_age)
+{
+    return BoardStatus{0, 0, 0, 0, Direction_RIGHT, 1, p_age};
+}
+
+int countCells(PublishedBoard const& p_board, Cell p_value)
+{
+    int l_count = 0;
+    for (int y = 0; y < p_board.height; ++y) {
+        for (int x = 0; x < p_board.width; ++x) {
+            l_count += p_board.cell(x, y) == p_value;
+        }
+    }
+    return l_count;
+}
+
+} // namespace
+
+TEST(BoardPublisherTest, test_NothingToReadBeforeTheFirstPublish)
+{
+    BoardPublisher const sut(4, 4);
+    PublishedBoard l_out{};
+
+    EXPECT_EQ(0u, sut.read(l_out));
+    EXPECT_TRUE(l_out.cells.empty());
+}
+
+TEST(BoardPublisherTest, test_ReadGivesEveryCellDrawnSoFar)
+{
+    BoardPublisher sut(40, 3, 2);
+    PublishedBoard l_out;
+
+    // More updates than copies, so that copies replay the ones they missed.
+    for (int x = 0; x < 10; ++x) {
+        sut.draw(x, 1, Cell_SNAKE);
+        if (x) {
+            sut.draw(x - 1, 1, Cell_FREE);
+        }
+        sut.publish(statusOfAge(x));
+    }
+    sut.draw(39, 2, Cell_FOOD);
+    sut.draw(40, 2, Cell_FOOD);
+    sut.publish(statusOfAge(10));
+
+    ASSERT_EQ(11u, sut.read(l_out));
+    EXPECT_EQ(10, l_out.status.age);
+    EXPECT_EQ(Cell_SNAKE, l_out.cell(9, 1));
+    EXPECT_EQ(Cell_FOOD, l_out.cell(39, 2));
+    EXPECT_EQ(1, countCells(l_out, Cell_SNAKE));
+    EXPECT_EQ(1, countCells(l_out, Cell_FOOD));
+}
+
+TEST(BoardPublisherTest, test_Clear_FreesCellsDrawnBefore)
+{
+    BoardPublisher sut(4, 4);
+    PublishedBoard l_out;
+
+    sut.draw(0, 0, Cell_SNAKE);
+    sut.publish(statusOfAge(0));
+    sut.draw(1, 1, Cell_SNAKE);
+    sut.clear();
+    sut.draw(2, 2, Cell_FOOD);
+    sut.publish(statusOfAge(1));
+
+    ASSERT_EQ(2u, sut.read(l_out));
+    EXPECT_EQ(0, countCells(l_out, Cell_SNAKE));
+    EXPECT_EQ(Cell_FOOD, l_out.cell(2, 2));
+}
+
+TEST(BoardPublisherTest, test_ReadersOnOtherThreads_NeverSeeATornBoard)
+{
+    // Update n moves a single snake cell to column n % 70 and publishes
+    // age n; a reader must see exactly that.
+    int const c_width = 70;
+    BoardPublisher sut(c_width, 2, 2);
+    std::atomic<bool> l_done{false};
+    std::atomic<int> l_failures{0};
+
+    std::vector<std::thread> l_readers;
+    for (int i = 0; i < 3; ++i) {
+        l_readers.emplace_back([&] {
+            PublishedBoard l_out;
+            std::uint64_t l_last = 0;
+            while (not l_done.load()) {
+                std::uint64_t const l_number = sut.read(l_out);
+                if (l_number < l_last or
+                    (l_number and (l_out.status.age != std::int64_t(l_number) or
+                                   l_out.cell(int(l_number % c_width), 1) != Cell_SNAKE or
+                                   countCells(l_out, Cell_SNAKE) != 1))) {
+                    ++l_failures;
+                }
+                l_last = l_number;
+            }
+        });
+    }
+
+    for (int l_number = 1; l_number <= 20000; ++l_number) {
+        sut.draw((l_number - 1) % c_width, 1, Cell_FREE);
+        sut.draw(l_number % c_width, 1, Cell_SNAKE);
+        sut.publish(statusOfAge(l_number));
+    }
+    l_done = true;
+    for (auto& l_reader : l_readers) {
+        l_reader.join();
+    }
+
+    EXPECT_EQ(0, l_failures.load());
+}
+
+TEST(BoardPublisherGameTest, test_ControllerPublishesEventsThatChangeTheGame)
+{
+    NullPort l_port;
+    BoardPublisher l_publisher(10, 10);
+    Controller l_controller(l_port, l_port, l_port, "W 10 10 F 9 9 S R 2 4 4 3 4");
+    PublishedBoard l_out;
+
+    l_controller.publishBoard(&l_publisher);
+    ASSERT_EQ(1u, l_publisher.read(l_out));
+    EXPECT_EQ(2, countCells(l_out, Cell_SNAKE));
+    EXPECT_EQ(Cell_FOOD, l_out.cell(9, 9));
+
+    l_controller.receive(std::make_unique<EventT<TimeoutInd>>());
+    EXPECT_EQ(2u, l_publisher.published());
+
+    // A turn draws nothing, but readers see it at once; a turn back onto
+    // the neck is ignored and publishes nothing.
+    l_controller.receive(ControllerInput(DirectionInd{Direction_DOWN}));
+    ASSERT_EQ(3u, l_publisher.read(l_out));
+    EXPECT_EQ(Direction_DOWN, l_out.status.direction);
+    l_controller.receive(ControllerInput(DirectionInd{Direction_UP}));
+    EXPECT_EQ(3u, l_publisher.published());
+
+    l_controller.receive(ControllerInput(TimeoutInd()));
+    ASSERT_EQ(4u, l_publisher.read(l_out));
+    EXPECT_EQ(Cell_SNAKE, l_out.cell(5, 5));
+    EXPECT_EQ(Cell_SNAKE, l_out.cell(5, 4));
+    EXPECT_EQ(2, countCells(l_out, Cell_SNAKE));
+    EXPECT_EQ(5, l_out.status.headX);
+    EXPECT_EQ(5, l_out.status.headY);
+    EXPECT_EQ(Direction_DOWN, l_out.status.direction);
+
+    l_controller.publishBoard(nullptr);
+    l_controller.receive(ControllerInput(TimeoutInd()));
+    EXPECT_EQ(4u, l_publisher.published());
+}
+
+TEST(BoardPublisherGameTest, test_PublisherOfAnotherSize_IsRejected)
+{
+    NullPort l_port;
+    BoardPublisher l_publisher(10, 9);
+    Controller l_controller(l_port, l_port, l_port, "W 10 10 F 9 9 S R 1 4 4");
+
+    EXPECT_THROW(l_controller.publishBoard(&l_publisher), std::invalid_argument);
+    EXPECT_EQ(0u, l_publisher.published());
+}
+
+} // namespace Snake
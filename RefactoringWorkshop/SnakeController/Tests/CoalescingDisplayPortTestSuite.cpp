@@ -0,0 +1,121 @@
+#include "CoalescingDisplayPort.hpp"
+
+#include "EventT.hpp"
+#include "SnakeController.hpp"
+
+#include <gtest/gtest.h>
+
+#include "Mocks/EventMatchers.hpp"
+#include "Mocks/PortMock.hpp"
+
+using namespace ::testing;
+
+namespace Snake
+{
+
+struct BatchRecorder : IPort
+{
+    void send(std::unique_ptr<Event> p_evt) override
+    {
+        singles.push_back(std::move(p_evt));
+    }
+
+    void sendBatch(EventBatch p_events) override
+    {
+        batches.emplace_back();
+        for (auto& l_evt : p_events) {
+            batches.back().push_back(std::move(l_evt));
+        }
+    }
+
+    std::vector<std::unique_ptr<Event>> singles;
+    std::vector<std::vector<std::unique_ptr<Event>>> batches;
+};
+
+std::unique_ptr<Event> makeDisplayInd(int p_x, int p_y, Cell p_value)
+{
+    return std::make_unique<EventT<DisplayInd>>(DisplayInd{p_x, p_y, p_value});
+}
+
+struct CoalescingDisplayPortTest : Test
+{
+    BatchRecorder downstream;
+    CoalescingDisplayPort sut{downstream};
+};
+
+TEST_F(CoalescingDisplayPortTest, test_NothingIsForwardedBeforeFlush)
+{
+    sut.send(makeDisplayInd(1, 1, Cell_SNAKE));
+
+    EXPECT_TRUE(downstream.batches.empty());
+    EXPECT_TRUE(downstream.singles.empty());
+}
+
+TEST_F(CoalescingDisplayPortTest, test_Flush_ForwardsTickAsSingleBatch)
+{
+    sut.send(makeDisplayInd(1, 1, Cell_FREE));
+    sut.send(makeDisplayInd(2, 1, Cell_SNAKE));
+    sut.flush();
+
+    ASSERT_EQ(1u, downstream.batches.size());
+    ASSERT_EQ(2u, downstream.batches[0].size());
+    EXPECT_THAT(*downstream.batches[0][0], DisplayIndEq(1, 1, Cell_FREE));
+    EXPECT_THAT(*downstream.batches[0][1], DisplayIndEq(2, 1, Cell_SNAKE));
+    EXPECT_TRUE(downstream.singles.empty());
+}
+
+TEST_F(CoalescingDisplayPortTest, test_RepeatedWritesToCell_KeepOnlyLastOne)
+{
+    sut.send(makeDisplayInd(5, 5, Cell_FREE));
+    sut.send(makeDisplayInd(6, 5, Cell_FOOD));
+    sut.send(makeDisplayInd(5, 5, Cell_SNAKE));
+    sut.flush();
+
+    ASSERT_EQ(1u, downstream.batches.size());
+    ASSERT_EQ(2u, downstream.batches[0].size());
+    EXPECT_THAT(*downstream.batches[0][0], DisplayIndEq(5, 5, Cell_SNAKE));
+    EXPECT_THAT(*downstream.batches[0][1], DisplayIndEq(6, 5, Cell_FOOD));
+    EXPECT_EQ(1u, sut.dropped());
+}
+
+TEST_F(CoalescingDisplayPortTest, test_CellsAreNotMergedAcrossFlushes)
+{
+    sut.send(makeDisplayInd(5, 5, Cell_SNAKE));
+    sut.flush();
+    sut.send(makeDisplayInd(5, 5, Cell_FREE));
+    sut.flush();
+
+    ASSERT_EQ(2u, downstream.batches.size());
+    EXPECT_THAT(*downstream.batches[1][0], DisplayIndEq(5, 5, Cell_FREE));
+}
+
+TEST_F(CoalescingDisplayPortTest, test_ManyCells_AreAllKept)
+{
+    for (int i = 0; i < 100; ++i) {
+        sut.send(makeDisplayInd(i, 0, Cell_SNAKE));
+    }
+    for (int i = 0; i < 100; ++i) {
+        sut.send(makeDisplayInd(i, 0, Cell_FREE));
+    }
+    sut.flush();
+
+    ASSERT_EQ(100u, downstream.batches[0].size());
+    EXPECT_THAT(*downstream.batches[0][99], DisplayIndEq(99, 0, Cell_FREE));
+}
+
+TEST_F(CoalescingDisplayPortTest, test_ControllerTick_ReachesDownstreamAsOneBatch)
+{
+    StrictMock<PortMock> foodPortMock;
+    StrictMock<PortMock> scorePortMock;
+    Controller l_controller(sut, foodPortMock, scorePortMock, "W 100 100 F 50 50 S R 2 20 20 19 20");
+
+    l_controller.receive(std::make_unique<EventT<TimeoutInd>>());
+    sut.flush();
+
+    ASSERT_EQ(1u, downstream.batches.size());
+    ASSERT_EQ(2u, downstream.batches[0].size());
+    EXPECT_THAT(*downstream.batches[0][0], DisplayIndEq(19, 20, Cell_FREE));
+    EXPECT_THAT(*downstream.batches[0][1], DisplayIndEq(21, 20, Cell_SNAKE));
+}
+
+} // namespace Snake
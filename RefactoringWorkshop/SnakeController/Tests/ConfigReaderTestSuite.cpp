@@ -0,0 +1,124 @@
+#include "ConfigReader.hpp"
+
+#include <vector>
+
+#include "EventT.hpp"
+#include "SnakeController.hpp"
+
+#include <gtest/gtest.h>
+
+#include "Mocks/PortMock.hpp"
+#include "Mocks/EventMatchers.hpp"
+
+using namespace ::testing;
+
+namespace Snake
+{
+namespace
+{
+
+std::size_t errorPosition(std::string const& p_config)
+{
+    try {
+        TextConfigReader l_reader(p_config);
+        ConfigHeader const l_header = l_reader.readHeader();
+        for (int i = 0; i < l_header.length; ++i) {
+            int x, y;
+            l_reader.readSegment(x, y);
+        }
+    } catch (ConfigurationError const& e) {
+        return e.position();
+    }
+    return std::string::npos;
+}
+
+} // namespace
+
+TEST(TextConfigReaderTest, test_ReadsHeaderAndSegments)
+{
+    std::string const l_config = "W 10 8\tF -1 +2\n S L 2 3 4 5 6";
+    TextConfigReader l_reader(l_config);
+
+    ConfigHeader const l_header = l_reader.readHeader();
+    EXPECT_EQ(10, l_header.width);
+    EXPECT_EQ(8, l_header.height);
+    EXPECT_EQ(-1, l_header.foodX);
+    EXPECT_EQ(2, l_header.foodY);
+    EXPECT_EQ(Direction_LEFT, l_header.direction);
+    EXPECT_EQ(2, l_header.length);
+
+    int x, y;
+    l_reader.readSegment(x, y);
+    EXPECT_EQ(3, x);
+    EXPECT_EQ(4, y);
+}
+
+TEST(TextConfigReaderTest, test_Errors_CarryOffsetOfItemAtFault)
+{
+    EXPECT_EQ(0u, errorPosition("X 100 100"));
+    EXPECT_EQ(3u, errorPosition("W  0 10 F 1 1 S R 1 1 1"));
+    EXPECT_EQ(16u, errorPosition("W 10 10 F 1 1 S Q 1 1 1"));
+    EXPECT_EQ(24u, errorPosition("W 10 10 F 1 1 S R 2 1 1 x 1"));
+    EXPECT_EQ(2u, errorPosition("W 99999999999 10"));
+    EXPECT_EQ(21u, errorPosition("W 10 10 F 1 1 S R 1 1"));
+}
+
+TEST(BinaryConfigReaderTest, test_TruncatedConfig_CarriesOffsetOfMissingField)
+{
+    std::vector<unsigned char> l_config;
+    encodeBinaryConfig("W 10 10 F 1 1 S R 2 5 5 4 5", l_config);
+    l_config.resize(l_config.size() - 1);
+
+    BinaryConfigReader l_reader(BinaryConfig{l_config.data(), l_config.size()});
+    l_reader.readHeader();
+    int x, y;
+    l_reader.readSegment(x, y);
+
+    try {
+        l_reader.readSegment(x, y);
+        FAIL() << "truncated config accepted";
+    } catch (ConfigurationError const& e) {
+        EXPECT_EQ(36u, e.position());
+    }
+}
+
+struct ConfigFormsTest : Test
+{
+    StrictMock<PortMock> displayPortMock;
+    StrictMock<PortMock> foodPortMock;
+    StrictMock<PortMock> scorePortMock;
+};
+
+TEST_F(ConfigFormsTest, test_BinaryConfig_BuildsSameController)
+{
+    std::vector<unsigned char> l_config;
+    encodeBinaryConfig("W 100 100 F 50 50 S R 2 20 20 19 20", l_config);
+    Controller sut(displayPortMock, foodPortMock, scorePortMock, BinaryConfig{l_config.data(), l_config.size()});
+
+    EXPECT_CALL(displayPortMock, send_rvr(DisplayIndEq(19, 20, Cell_FREE)));
+    EXPECT_CALL(displayPortMock, send_rvr(DisplayIndEq(21, 20, Cell_SNAKE)));
+
+    sut.receive(std::make_unique<EventT<TimeoutInd>>());
+}
+
+TEST_F(ConfigFormsTest, test_OverlappingSegments_ThrowAtSecondSegment)
+{
+    try {
+        Controller sut(displayPortMock, foodPortMock, scorePortMock, "W 10 10 F 1 1 S R 2 3 3 3 3");
+        FAIL() << "overlapping segments accepted";
+    } catch (ConfigurationError const& e) {
+        EXPECT_EQ(24u, e.position());
+    }
+}
+
+TEST_F(ConfigFormsTest, test_SnakeLongerThanMap_Throws)
+{
+    std::vector<unsigned char> l_config;
+    encodeBinaryConfig("W 1 1 F 0 0 S R 1 0 0", l_config);
+    l_config[20] = 0x7f;
+
+    EXPECT_THROW(Controller(displayPortMock, foodPortMock, scorePortMock, BinaryConfig{l_config.data(), l_config.size()}),
+                 ConfigurationError);
+}
+
+} // namespace Snake
@@ -0,0 +1,163 @@
+#include "ControllerMetrics.hpp"
+
+#include <sstream>
+
+#include "EventT.hpp"
+#include "SnakeController.hpp"
+
+#include <gtest/gtest.h>
+
+#include "Mocks/PortMock.hpp"
+
+using namespace ::testing;
+
+namespace Snake
+{
+
+TEST(LatencyHistogramTest, test_Empty_ReportsZero)
+{
+    LatencyHistogram l_histogram;
+
+    EXPECT_EQ(0u, l_histogram.count());
+    EXPECT_EQ(0u, l_histogram.percentile(99));
+}
+
+TEST(LatencyHistogramTest, test_SmallValues_AreExact)
+{
+    LatencyHistogram l_histogram;
+    for (std::uint64_t i = 1; i <= 4; ++i) {
+        l_histogram.record(i);
+    }
+
+    EXPECT_EQ(4u, l_histogram.count());
+    EXPECT_EQ(10u, l_histogram.total());
+    EXPECT_EQ(2u, l_histogram.percentile(50));
+    EXPECT_EQ(4u, l_histogram.percentile(100));
+}
+
+TEST(LatencyHistogramTest, test_LargeValues_StayWithinRelativeError)
+{
+    LatencyHistogram l_histogram;
+    for (std::uint64_t i = 0; i < 99; ++i) {
+        l_histogram.record(1000);
+    }
+    l_histogram.record(1000000);
+
+    EXPECT_GE(l_histogram.percentile(50), 1000u);
+    EXPECT_LE(l_histogram.percentile(50), 1000u + 1000u / 8);
+    EXPECT_EQ(1000000u, l_histogram.percentile(100));
+    EXPECT_EQ(1000000u, l_histogram.max());
+}
+
+TEST(LatencyHistogramTest, test_HugeValues_LandInLastBucket)
+{
+    LatencyHistogram l_histogram;
+    l_histogram.record(std::uint64_t(1) << 62);
+
+    EXPECT_EQ(std::uint64_t(1) << 62, l_histogram.percentile(50));
+}
+
+TEST(ControllerMetricsTest, test_WriteMetrics_ListsEveryMessage)
+{
+    ControllerMetrics l_metrics;
+    l_metrics.receiveLatency(0x20).record(100);
+    l_metrics.receiveLatency(0x10).record(50);
+    l_metrics.portSendLatency.record(10);
+
+    std::ostringstream l_out;
+    writeMetrics(l_out, l_metrics);
+
+    EXPECT_NE(std::string::npos, l_out.str().find("\"messageId\":32,\"count\":1"));
+    EXPECT_NE(std::string::npos, l_out.str().find("\"messageId\":16,\"count\":1"));
+    EXPECT_NE(std::string::npos, l_out.str().find("\"portSend\":{\"count\":1"));
+}
+
+#ifdef SNAKE_CONTROLLER_METRICS
+struct ControllerInstrumentationTest : Test
+{
+    NiceMock<PortMock> displayPortMock;
+    NiceMock<PortMock> foodPortMock;
+    NiceMock<PortMock> scorePortMock;
+
+    Controller sut{displayPortMock, foodPortMock, scorePortMock, "W 10 10 F 3 0 S R 1 1 0"};
+};
+
+TEST_F(ControllerInstrumentationTest, test_Receive_CountsEachMessageType)
+{
+    sut.receive(std::make_unique<EventT<TimeoutInd>>());
+    sut.receive(std::make_unique<EventT<TimeoutInd>>());
+    sut.receive(std::make_unique<EventT<DirectionInd>>(DirectionInd{Direction_DOWN}));
+
+    auto const l_metrics = sut.metrics();
+    ASSERT_NE(nullptr, l_metrics.find(TimeoutInd::MESSAGE_ID));
+    ASSERT_NE(nullptr, l_metrics.find(DirectionInd::MESSAGE_ID));
+    EXPECT_EQ(2u, l_metrics.find(TimeoutInd::MESSAGE_ID)->receiveLatency.count());
+    EXPECT_EQ(1u, l_metrics.find(DirectionInd::MESSAGE_ID)->receiveLatency.count());
+    EXPECT_EQ(nullptr, l_metrics.find(FoodInd::MESSAGE_ID));
+}
+
+TEST_F(ControllerInstrumentationTest, test_PortSends_AreTimedSeparately)
+{
+    // Moves onto the food: one display batch, ScoreInd and FoodReq.
+    sut.receive(std::make_unique<EventT<TimeoutInd>>());
+    sut.receive(std::make_unique<EventT<TimeoutInd>>());
+
+    EXPECT_EQ(4u, sut.metrics().portSendLatency.count());
+}
+
+TEST_F(ControllerInstrumentationTest, test_UnexpectedEvent_IsCountedToo)
+{
+    EXPECT_THROW(sut.receive(std::make_unique<EventT<ScoreInd>>()), UnexpectedEventException);
+
+    ASSERT_NE(nullptr, sut.metrics().find(ScoreInd::MESSAGE_ID));
+    EXPECT_EQ(1u, sut.metrics().find(ScoreInd::MESSAGE_ID)->receiveLatency.count());
+}
+
+TEST_F(ControllerInstrumentationTest, test_ResetMetrics_ForgetsEverything)
+{
+    sut.receive(std::make_unique<EventT<TimeoutInd>>());
+    sut.resetMetrics();
+
+    EXPECT_TRUE(sut.metrics().messages.empty());
+    EXPECT_EQ(0u, sut.metrics().portSendLatency.count());
+}
+
+namespace
+{
+
+// Score port feeding a DirectionInd back into the controller while it
+// still handles the TimeoutInd that made the snake eat.
+struct ReentrantPort : IPort
+{
+    void send(std::unique_ptr<Event>) override
+    {
+        if (controller) {
+            Controller* const l_controller = controller;
+            controller = nullptr;
+            l_controller->receive(std::make_unique<EventT<DirectionInd>>(DirectionInd{Direction_DOWN}));
+        }
+    }
+
+    Controller* controller = nullptr;
+};
+
+} // namespace
+
+TEST(ControllerInstrumentationReentryTest, test_EventsReceivedWhileHandlingAnother_AreCountedToo)
+{
+    NiceMock<PortMock> l_port;
+    ReentrantPort l_scorePort;
+    Controller l_sut(l_port, l_port, l_scorePort, "W 10 10 F 2 0 S R 1 1 0");
+    l_scorePort.controller = &l_sut;
+
+    l_sut.receive(std::make_unique<EventT<TimeoutInd>>());
+
+    auto const l_metrics = l_sut.metrics();
+    ASSERT_NE(nullptr, l_metrics.find(TimeoutInd::MESSAGE_ID));
+    ASSERT_NE(nullptr, l_metrics.find(DirectionInd::MESSAGE_ID));
+    EXPECT_EQ(1u, l_metrics.find(TimeoutInd::MESSAGE_ID)->receiveLatency.count());
+    EXPECT_EQ(1u, l_metrics.find(DirectionInd::MESSAGE_ID)->receiveLatency.count());
+}
+#endif
+
+} // namespace Snake
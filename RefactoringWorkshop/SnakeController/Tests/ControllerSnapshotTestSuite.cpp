@@ -0,0 +1,211 @@
+#include "SnakeController.hpp"
+
+#include <cstring>
+#include <vector>
+
+#include "EventT.hpp"
+#include "SessionManager.hpp"
+#include "SnakeWireFormat.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace ::testing;
+
+namespace Snake
+{
+namespace
+{
+
+// Keeps everything sent through it in wire form, so that the output of
+// two controllers can be compared byte for byte.
+struct WirePort : IPort
+{
+    void send(std::unique_ptr<Event> p_evt) override { WireCodec::encode(*p_evt, bytes); }
+
+    std::vector<unsigned char> bytes;
+};
+
+struct Game
+{
+    WirePort display;
+    WirePort food;
+    WirePort score;
+    std::unique_ptr<Controller> controller;
+
+    void play(std::vector<ControllerInput> const& p_inputs)
+    {
+        for (auto const& l_input : p_inputs) {
+            controller->receive(l_input);
+        }
+    }
+};
+
+// Grows by eating twice, turns, moves food around and finally bites its
+// own body.
+std::vector<ControllerInput> opening()
+{
+    return {TimeoutInd(), TimeoutInd(), FoodResp{8, 5}, TimeoutInd(), TimeoutInd(),
+            DirectionInd{Direction_DOWN}, TimeoutInd(), FoodInd{8, 7}, TimeoutInd(), TimeoutInd()};
+}
+
+std::vector<ControllerInput> continuation()
+{
+    return {DirectionInd{Direction_LEFT}, TimeoutInd(), TimeoutInd(), FoodInd{2, 2},
+            DirectionInd{Direction_UP}, TimeoutInd(), DirectionInd{Direction_RIGHT}, TimeoutInd(),
+            TimeoutInd(), DirectionInd{Direction_DOWN}, TimeoutInd(), TimeoutInd()};
+}
+
+} // namespace
+
+struct ControllerSnapshotTest : Test
+{
+    Game original;
+    Game restored;
+    std::vector<unsigned char> snapshot;
+
+    void SetUp() override
+    {
+        original.controller = std::make_unique<Controller>(
+            original.display, original.food, original.score, "W 12 12 F 6 5 S R 3 4 5 3 5 2 5");
+        original.play(opening());
+        original.controller->snapshot(snapshot);
+    }
+
+    void restore()
+    {
+        restored.controller = std::make_unique<Controller>(
+            restored.display, restored.food, restored.score, ControllerSnapshot{snapshot.data(), snapshot.size()});
+    }
+};
+
+TEST_F(ControllerSnapshotTest, test_RestoredController_ContinuesWithIdenticalOutput)
+{
+    restore();
+    original.display.bytes.clear();
+    original.food.bytes.clear();
+    original.score.bytes.clear();
+
+    original.play(continuation());
+    restored.play(continuation());
+
+    EXPECT_FALSE(original.display.bytes.empty());
+    EXPECT_EQ(original.display.bytes, restored.display.bytes);
+    EXPECT_EQ(original.food.bytes, restored.food.bytes);
+    EXPECT_EQ(original.score.bytes, restored.score.bytes);
+}
+
+TEST_F(ControllerSnapshotTest, test_SnapshotOfRestoredController_IsIdentical)
+{
+    restore();
+
+    std::vector<unsigned char> l_again;
+    restored.controller->snapshot(l_again);
+
+    EXPECT_EQ(snapshot, l_again);
+}
+
+TEST_F(ControllerSnapshotTest, test_TruncatedSnapshot_Throws)
+{
+    snapshot.pop_back();
+
+    EXPECT_THROW(restore(), ConfigurationError);
+}
+
+TEST_F(ControllerSnapshotTest, test_OverlappingSegments_ThrowWithOffset)
+{
+    SnapshotSegment l_first;
+    std::memcpy(&l_first, &snapshot[sizeof(SnapshotHeader)], sizeof(l_first));
+    std::memcpy(&snapshot[sizeof(SnapshotHeader) + sizeof(l_first)], &l_first, sizeof(l_first));
+
+    try {
+        restore();
+        FAIL() << "overlapping segments accepted";
+    } catch (ConfigurationError const& e) {
+        EXPECT_EQ(sizeof(SnapshotHeader) + sizeof(SnapshotSegment), e.position());
+    }
+}
+
+TEST_F(ControllerSnapshotTest, test_RelocatingController_RestoresWithIdenticalFoodPlacement)
+{
+    // Food sent onto the snake is moved to a random free cell; the game
+    // is cut in the middle of it.
+    std::vector<ControllerInput> const l_collisions = {
+        FoodResp{4, 5}, TimeoutInd(), FoodInd{8, 6}, TimeoutInd(), FoodInd{8, 5}, TimeoutInd()};
+
+    original.controller = std::make_unique<Controller>(
+        original.display, original.food, original.score, "W 12 12 F 6 5 S R 3 4 5 3 5 2 5");
+    original.controller->relocateCollidingFood(3);
+    original.play(l_collisions);
+    snapshot.clear();
+    original.controller->snapshot(snapshot);
+
+    restore();
+    std::vector<unsigned char> l_again;
+    restored.controller->snapshot(l_again);
+    EXPECT_EQ(snapshot, l_again);
+
+    original.display.bytes.clear();
+    original.food.bytes.clear();
+    original.play(l_collisions);
+    restored.play(l_collisions);
+
+    EXPECT_FALSE(original.display.bytes.empty());
+    EXPECT_EQ(original.display.bytes, restored.display.bytes);
+    EXPECT_EQ(original.food.bytes, restored.food.bytes);
+}
+
+TEST_F(ControllerSnapshotTest, test_FreeCellOrderNotMatchingTheSnake_Throws)
+{
+    original.controller->relocateCollidingFood();
+    snapshot.clear();
+    original.controller->snapshot(snapshot);
+
+    // Swaps the first free slot with the last, occupied one.
+    std::size_t const l_order = snapshot.size() - 12 * 12 * sizeof(std::uint32_t);
+    std::uint32_t l_first;
+    std::uint32_t l_last;
+    std::memcpy(&l_first, &snapshot[l_order], sizeof(l_first));
+    std::memcpy(&l_last, &snapshot[snapshot.size() - sizeof(l_last)], sizeof(l_last));
+    std::memcpy(&snapshot[l_order], &l_last, sizeof(l_last));
+    std::memcpy(&snapshot[snapshot.size() - sizeof(l_first)], &l_first, sizeof(l_first));
+
+    try {
+        restore();
+        FAIL() << "free cell order accepted";
+    } catch (ConfigurationError const& e) {
+        EXPECT_EQ(l_order, e.position());
+    }
+}
+
+TEST(ShardSnapshotTest, test_ShardSnapshot_RestoresEverySession)
+{
+    SessionManager l_source(2);
+    WirePort l_sourcePorts[9];
+    for (int i = 0; i < 3; ++i) {
+        l_source.createSession(l_sourcePorts[3 * i], l_sourcePorts[3 * i + 1], l_sourcePorts[3 * i + 2],
+                               "W 20 20 F 19 19 S D 2 " + std::to_string(i) + " 1 " + std::to_string(i) + " 0");
+    }
+    l_source.tick();
+
+    std::vector<unsigned char> l_shard;
+    l_source.snapshotShard(0, l_shard);
+    auto const l_records = splitShardSnapshot(l_shard.data(), l_shard.size());
+
+    ASSERT_EQ(2u, l_records.size());
+    EXPECT_EQ(0u, l_records[0].session);
+    EXPECT_EQ(2u, l_records[1].session);
+
+    SessionManager l_target(1);
+    WirePort l_targetPorts[3];
+    l_target.createSession(l_targetPorts[0], l_targetPorts[1], l_targetPorts[2], l_records[1].state);
+
+    l_sourcePorts[6].bytes.clear();
+    l_source.tick();
+    l_target.tick();
+    l_source.waitIdle();
+    l_target.waitIdle();
+
+    EXPECT_EQ(l_sourcePorts[6].bytes, l_targetPorts[0].bytes);
+}
+
+} // namespace Snake
@@ -0,0 +1,164 @@
+#include "DisplayStream.hpp"
+
+#include <random>
+#include <vector>
+
+#include "EventT.hpp"
+#include "SnakeController.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace ::testing;
+
+namespace Snake
+{
+namespace
+{
+
+struct NullPort : IPort
+{
+    void send(std::unique_ptr<Event>) override {}
+};
+
+// What a viewer that saw every DisplayInd draws.
+struct ReferenceBoard
+{
+    ReferenceBoard(int p_width, int p_height)
+        : width(p_width),
+          cells(std::size_t(p_width) * std::size_t(p_height), Cell_FREE)
+    {}
+
+    void apply(DisplayInd const& p_displayInd) { cells[std::size_t(p_displayInd.y) * width + p_displayInd.x] = p_displayInd.value; }
+
+    int width;
+    std::vector<Cell> cells;
+};
+
+void expectBoard(ReferenceBoard const& p_expected, DisplayStreamDecoder const& p_decoder)
+{
+    ASSERT_TRUE(p_decoder.synchronized());
+    ASSERT_EQ(p_expected.width, p_decoder.width());
+    for (int y = 0; y < p_decoder.height(); ++y) {
+        for (int x = 0; x < p_decoder.width(); ++x) {
+            ASSERT_EQ(p_expected.cells[std::size_t(y) * p_expected.width + x], p_decoder.cell(x, y))
+                << "at " << x << ", " << y;
+        }
+    }
+}
+
+} // namespace
+
+TEST(DisplayStreamTest, test_RandomUpdates_RebuildTheBoard)
+{
+    std::mt19937 l_random(17);
+    std::uniform_int_distribution<int> l_x(0, 39), l_y(0, 29), l_cell(Cell_FREE, Cell_SNAKE), l_count(0, 4);
+
+    DisplayStreamEncoder l_encoder(40, 30, 16);
+    DisplayStreamDecoder l_decoder;
+    ReferenceBoard l_expected(40, 30);
+    std::vector<unsigned char> l_stream;
+
+    for (int l_frame = 0; l_frame < 100; ++l_frame) {
+        for (int i = l_count(l_random); i; --i) {
+            DisplayInd const l_update{l_x(l_random), l_y(l_random), static_cast<Cell>(l_cell(l_random))};
+            l_encoder.add(l_update);
+            l_expected.apply(l_update);
+        }
+        l_encoder.finishFrame(l_stream);
+    }
+
+    EXPECT_EQ(l_stream.size(), l_decoder.decode(l_stream.data(), l_stream.size()));
+    expectBoard(l_expected, l_decoder);
+}
+
+TEST(DisplayStreamTest, test_PartialFrame_IsLeftForNextCall)
+{
+    DisplayStreamEncoder l_encoder(8, 8, 0);
+    DisplayStreamDecoder l_decoder;
+    std::vector<unsigned char> l_stream;
+
+    l_encoder.add(DisplayInd{3, 4, Cell_FOOD});
+    l_encoder.finishFrame(l_stream);
+
+    EXPECT_EQ(0u, l_decoder.decode(l_stream.data(), l_stream.size() - 1));
+    EXPECT_FALSE(l_decoder.synchronized());
+    EXPECT_EQ(l_stream.size(), l_decoder.decode(l_stream.data(), l_stream.size()));
+    EXPECT_EQ(Cell_FOOD, l_decoder.cell(3, 4));
+}
+
+TEST(DisplayStreamTest, test_LateViewer_SynchronizesOnKeyframe)
+{
+    DisplayStreamEncoder l_encoder(8, 8, 0);
+    DisplayStreamDecoder l_decoder;
+    std::vector<unsigned char> l_missed, l_stream;
+
+    l_encoder.add(DisplayInd{1, 1, Cell_SNAKE});
+    l_encoder.finishFrame(l_missed);
+    l_encoder.add(DisplayInd{2, 1, Cell_SNAKE});
+    l_encoder.finishFrame(l_stream);
+    l_encoder.requestKeyframe();
+    l_encoder.finishFrame(l_stream);
+
+    EXPECT_EQ(l_stream.size(), l_decoder.decode(l_stream.data(), l_stream.size()));
+    EXPECT_EQ(Cell_SNAKE, l_decoder.cell(1, 1));
+    EXPECT_EQ(Cell_SNAKE, l_decoder.cell(2, 1));
+}
+
+TEST(DisplayStreamTest, test_NoUpdates_NoFrame)
+{
+    DisplayStreamEncoder l_encoder(8, 8, 4);
+    std::vector<unsigned char> l_stream;
+
+    l_encoder.finishFrame(l_stream);
+    std::size_t const l_keyframeSize = l_stream.size();
+    l_encoder.finishFrame(l_stream);
+
+    EXPECT_EQ(l_keyframeSize, l_stream.size());
+}
+
+TEST(DisplayStreamTest, test_MalformedFrames_Throw)
+{
+    DisplayStreamDecoder l_decoder;
+    unsigned char const l_unknownKind[] = {1, 7};
+    unsigned char const l_shortKeyframe[] = {4, 1, 2, 2, 0};
+    unsigned char const l_badCell[] = {4, 1, 1, 1, 3};
+
+    EXPECT_THROW(l_decoder.decode(l_unknownKind, sizeof(l_unknownKind)), DisplayStreamError);
+    EXPECT_THROW(l_decoder.decode(l_shortKeyframe, sizeof(l_shortKeyframe)), DisplayStreamError);
+    EXPECT_THROW(l_decoder.decode(l_badCell, sizeof(l_badCell)), DisplayStreamError);
+    EXPECT_FALSE(l_decoder.synchronized());
+}
+
+TEST(DisplayStreamTest, test_UpdateOutsideBoard_Throws)
+{
+    DisplayStreamDecoder l_decoder;
+    unsigned char const l_stream[] = {4, 1, 1, 1, 0, 3, 0, 1, 4 << 2 | 2};
+
+    EXPECT_THROW(l_decoder.decode(l_stream, sizeof(l_stream)), DisplayStreamError);
+}
+
+TEST(DisplayStreamTest, test_DisplayStreamPort_EncodesControllerOutput)
+{
+    DisplayStreamEncoder l_encoder(10, 10, 8);
+    std::vector<unsigned char> l_stream;
+    DisplayStreamPort l_displayPort(l_encoder, l_stream);
+    NullPort l_foodPort, l_scorePort;
+    Controller l_controller(l_displayPort, l_foodPort, l_scorePort, "W 10 10 F 5 5 S R 3 2 1 1 1 0 1");
+
+    l_controller.receive(ControllerInput(FoodResp{7, 1}));
+    for (int i = 0; i < 4; ++i) {
+        l_controller.receive(ControllerInput(TimeoutInd{}));
+    }
+
+    DisplayStreamDecoder l_decoder;
+    l_decoder.decode(l_stream.data(), l_stream.size());
+
+    ReferenceBoard l_expected(10, 10);
+    l_expected.apply(DisplayInd{7, 1, Cell_FOOD});
+    for (int x = 4; x <= 6; ++x) {
+        l_expected.apply(DisplayInd{x, 1, Cell_SNAKE});
+    }
+    expectBoard(l_expected, l_decoder);
+}
+
+} // namespace Snake
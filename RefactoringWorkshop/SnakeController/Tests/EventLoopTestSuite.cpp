@@ -0,0 +1,184 @@
+#include "EventLoop.hpp"
+
+#include <string>
+#include <vector>
+
+#include "AsyncSessionHost.hpp"
+#include "EventT.hpp"
+#include "IEventHandler.hpp"
+#include "IPort.hpp"
+#include "SnakeInterface.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace ::testing;
+using namespace std::chrono_literals;
+
+namespace Snake
+{
+namespace
+{
+
+struct RecordingPort : IPort
+{
+    void send(std::unique_ptr<Event> p_evt) override { events.push_back(std::move(p_evt)); }
+
+    std::size_t count(std::uint32_t p_messageId) const
+    {
+        std::size_t l_count = 0;
+        for (auto const& l_evt : events) {
+            l_count += l_evt->getMessageId() == p_messageId;
+        }
+        return l_count;
+    }
+
+    std::vector<std::unique_ptr<Event>> events;
+};
+
+struct RecordingHandler : IEventHandler
+{
+    void receive(std::unique_ptr<Event> p_evt) override { ids.push_back(p_evt->getMessageId()); }
+
+    std::vector<std::uint32_t> ids;
+};
+
+} // namespace
+
+struct EventLoopTest : Test
+{
+    EventLoop::Clock::time_point time{};
+    EventLoop sut{[this] { return time; }, [this](EventLoop::Clock::time_point p_wakeUp) { time = p_wakeUp; }};
+    std::vector<std::string> log;
+};
+
+TEST_F(EventLoopTest, test_PostedJobs_RunInOrder)
+{
+    RecordingHandler l_handler;
+    sut.post([this] { log.push_back("first"); });
+    sut.post(l_handler, std::make_unique<EventT<TimeoutInd>>());
+    sut.post([this] { log.push_back("second"); });
+
+    EXPECT_EQ(3u, sut.runOnce());
+    EXPECT_EQ((std::vector<std::string>{"first", "second"}), log);
+    EXPECT_EQ(std::vector<std::uint32_t>{TimeoutInd::MESSAGE_ID}, l_handler.ids);
+}
+
+TEST_F(EventLoopTest, test_JobsPostedWhileRunning_WaitForNextRun)
+{
+    sut.post([this] { sut.post([this] { log.push_back("later"); }); });
+
+    EXPECT_EQ(1u, sut.runOnce());
+    EXPECT_TRUE(log.empty());
+    EXPECT_EQ(1u, sut.runOnce());
+    EXPECT_EQ(std::vector<std::string>{"later"}, log);
+}
+
+TEST_F(EventLoopTest, test_Timer_RunsWhenDue)
+{
+    sut.startTimer(time + 10ms, [this] { log.push_back("timer"); });
+
+    time += 9ms;
+    EXPECT_EQ(0u, sut.runOnce());
+    time += 1ms;
+    EXPECT_EQ(1u, sut.runOnce());
+    EXPECT_EQ(0u, sut.timerCount());
+}
+
+TEST_F(EventLoopTest, test_CancelledTimer_DoesNotRun)
+{
+    auto const l_timer = sut.startTimer(time + 10ms, [this] { log.push_back("timer"); });
+
+    EXPECT_TRUE(sut.cancelTimer(l_timer));
+    EXPECT_FALSE(sut.cancelTimer(l_timer));
+    time += 10ms;
+
+    EXPECT_EQ(0u, sut.runOnce());
+    EXPECT_TRUE(log.empty());
+}
+
+TEST_F(EventLoopTest, test_PeriodicTimer_DoesNotDriftAndMayCancelItself)
+{
+    EventLoop::TimerId l_timer = 0;
+    l_timer = sut.startTimer(time + 10ms, 10ms, [this, &l_timer] {
+        log.push_back(std::to_string(time.time_since_epoch() / 1ms));
+        if (log.size() == 3) {
+            sut.cancelTimer(l_timer);
+        }
+    });
+
+    for (int i = 0; i < 5; ++i) {
+        time += 13ms;
+        sut.runOnce();
+    }
+
+    EXPECT_EQ((std::vector<std::string>{"13", "26", "39"}), log);
+    EXPECT_EQ(0u, sut.timerCount());
+    EXPECT_EQ(3u, sut.schedulingLatency().count());
+    EXPECT_EQ(9000000u, sut.schedulingLatency().max());
+}
+
+TEST_F(EventLoopTest, test_StalledPeriodicTimer_RunsOnceAndSkipsMissedPeriods)
+{
+    sut.startTimer(time + 10ms, 10ms, [this] { log.push_back(std::to_string(time.time_since_epoch() / 1ms)); });
+
+    time += 55ms;
+    EXPECT_EQ(1u, sut.runOnce());
+    time += 4ms;
+    EXPECT_EQ(0u, sut.runOnce());
+    time += 1ms;
+    EXPECT_EQ(1u, sut.runOnce());
+
+    EXPECT_EQ((std::vector<std::string>{"55", "60"}), log);
+}
+
+TEST_F(EventLoopTest, test_RunUntil_SleepsOnTheLoopsClock)
+{
+    sut.startTimer(time + 10ms, 10ms, [this] { log.push_back(std::to_string(time.time_since_epoch() / 1ms)); });
+
+    sut.runUntil(time + 35ms);
+
+    EXPECT_EQ((std::vector<std::string>{"10", "20", "30"}), log);
+    EXPECT_EQ(35ms, time.time_since_epoch());
+    EXPECT_EQ(0u, sut.schedulingLatency().max());
+}
+
+TEST_F(EventLoopTest, test_Sessions_TickAndWaitForFood)
+{
+    AsyncSessionHost l_host(sut, 10ms, 25ms);
+    RecordingPort l_display, l_score;
+    l_host.createSession(l_display, l_score, "W 10 10 F 2 0 S R 1 0 0");
+    l_host.createSession(l_display, l_score, "W 10 10 F 9 9 S R 1 0 5");
+
+    for (int i = 0; i < 2; ++i) {
+        time += 10ms;
+        sut.runOnce();
+    }
+    EXPECT_EQ(4u, l_host.stats().ticks);
+    EXPECT_EQ(1u, l_host.stats().foodRequests);
+    EXPECT_EQ(0u, l_host.stats().foodResponses);
+
+    time += 25ms;
+    sut.runOnce();
+
+    EXPECT_EQ(1u, l_host.stats().foodResponses);
+    EXPECT_EQ(1u, l_score.count(ScoreInd::MESSAGE_ID));
+    EXPECT_EQ(0u, l_host.stats().errors);
+}
+
+TEST_F(EventLoopTest, test_PostedSessionEvents_ReachTheController)
+{
+    AsyncSessionHost l_host(sut, 10ms, 25ms);
+    RecordingPort l_display, l_score;
+    auto const l_session = l_host.createSession(l_display, l_score, "W 10 10 F 9 9 S R 1 5 5");
+
+    l_host.post(l_session, std::make_unique<EventT<DirectionInd>>(DirectionInd{Direction_UP}));
+    sut.runOnce();
+    time += 10ms;
+    sut.runOnce();
+
+    ASSERT_EQ(2u, l_display.events.size());
+    EXPECT_EQ(4, payload<DisplayInd>(*l_display.events[1]).y);
+    EXPECT_THROW(l_host.post(7, std::make_unique<EventT<TimeoutInd>>()), std::out_of_range);
+}
+
+} // namespace Snake
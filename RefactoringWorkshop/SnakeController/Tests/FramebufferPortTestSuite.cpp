@@ -0,0 +1,138 @@
+#include "FramebufferPort.hpp"
+
+#include <random>
+#include <typeinfo>
+#include <vector>
+
+#include "EventT.hpp"
+#include "SnakeController.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace ::testing;
+
+namespace Snake
+{
+namespace
+{
+
+struct NullPort : IPort
+{
+    void send(std::unique_ptr<Event>) override {}
+};
+
+bool operator==(FrameRect const& p_lhs, FrameRect const& p_rhs)
+{
+    return p_lhs.x == p_rhs.x and p_lhs.y == p_rhs.y and p_lhs.width == p_rhs.width and p_lhs.height == p_rhs.height;
+}
+
+} // namespace
+
+struct FramebufferPortTest : Test
+{
+    FramebufferPort sut{200, 100};
+
+    void draw(int p_x, int p_y, Cell p_value)
+    {
+        sut.send(std::make_unique<EventT<DisplayInd>>(DisplayInd{p_x, p_y, p_value}));
+    }
+};
+
+TEST_F(FramebufferPortTest, test_KeepsTheLastValueOfEveryCell)
+{
+    draw(5, 6, Cell_SNAKE);
+    draw(199, 99, Cell_FOOD);
+    draw(5, 6, Cell_FREE);
+    draw(31, 0, Cell_SNAKE);
+    draw(32, 0, Cell_FOOD);
+
+    EXPECT_EQ(Cell_FREE, sut.cell(5, 6));
+    EXPECT_EQ(Cell_FOOD, sut.cell(199, 99));
+    EXPECT_EQ(Cell_SNAKE, sut.cell(31, 0));
+    EXPECT_EQ(Cell_FOOD, sut.cell(32, 0));
+    EXPECT_EQ(Cell_FREE, sut.cell(200, 0));
+}
+
+TEST_F(FramebufferPortTest, test_EndTick_BoundsTheChangesOfEveryTile)
+{
+    draw(10, 20, Cell_SNAKE);
+    draw(70, 5, Cell_FOOD);
+    draw(12, 3, Cell_SNAKE);
+    sut.endTick();
+
+    ASSERT_EQ(2u, sut.dirtyRects().size());
+    EXPECT_TRUE((FrameRect{10, 3, 3, 18}) == sut.dirtyRects()[0]);
+    EXPECT_TRUE((FrameRect{70, 5, 1, 1}) == sut.dirtyRects()[1]);
+
+    sut.endTick();
+    EXPECT_TRUE(sut.dirtyRects().empty());
+}
+
+TEST_F(FramebufferPortTest, test_UnchangedAndOffBoardCells_AreNotDirty)
+{
+    draw(1, 1, Cell_FREE);
+    draw(-1, 1, Cell_SNAKE);
+    draw(1, 100, Cell_SNAKE);
+    sut.endTick();
+
+    EXPECT_TRUE(sut.dirtyRects().empty());
+}
+
+TEST_F(FramebufferPortTest, test_CopyRect_GivesCellsRowAfterRow)
+{
+    draw(63, 10, Cell_SNAKE);
+    draw(64, 11, Cell_FOOD);
+
+    std::vector<std::uint8_t> l_cells;
+    sut.copyRect(FrameRect{63, 10, 2, 2}, l_cells);
+
+    EXPECT_EQ((std::vector<std::uint8_t>{Cell_SNAKE, Cell_FREE, Cell_FREE, Cell_FOOD}), l_cells);
+}
+
+TEST_F(FramebufferPortTest, test_OtherEvents_Throw)
+{
+    EXPECT_THROW(sut.send(std::make_unique<EventT<TimeoutInd>>()), std::bad_cast);
+}
+
+TEST(FramebufferPortGameTest, test_DirtyRectsBringAViewerUpToDate)
+{
+    NullPort l_port;
+    FramebufferPort l_framebuffer(150, 150);
+    Controller l_controller(l_framebuffer, l_port, l_port, "W 150 150 F 149 149 S R 1 0 60");
+    l_framebuffer.endTick();
+
+    // A viewer copying only the dirty rectangles of every tick.
+    std::vector<std::uint8_t> l_viewer(150 * 150, Cell_FREE);
+    std::minstd_rand l_random(3);
+    Direction const l_turns[] = {Direction_DOWN, Direction_RIGHT, Direction_UP, Direction_RIGHT};
+
+    for (int l_tick = 0; l_tick < 200; ++l_tick) {
+        if (l_tick % 10 == 0) {
+            l_controller.receive(std::make_unique<EventT<DirectionInd>>(DirectionInd{l_turns[l_tick / 10 % 4]}));
+        }
+        if (l_tick % 7 == 0) {
+            l_controller.receive(std::make_unique<EventT<FoodInd>>(
+                FoodInd{std::uniform_int_distribution<int>(0, 149)(l_random), std::uniform_int_distribution<int>(0, 149)(l_random)}));
+        }
+        l_controller.receive(std::make_unique<EventT<TimeoutInd>>());
+        l_framebuffer.endTick();
+
+        for (FrameRect const& l_rect : l_framebuffer.dirtyRects()) {
+            std::vector<std::uint8_t> l_cells;
+            l_framebuffer.copyRect(l_rect, l_cells);
+            for (int y = 0; y < l_rect.height; ++y) {
+                for (int x = 0; x < l_rect.width; ++x) {
+                    l_viewer[std::size_t(l_rect.y + y) * 150 + std::size_t(l_rect.x + x)] = l_cells[std::size_t(y * l_rect.width + x)];
+                }
+            }
+        }
+    }
+
+    for (int y = 0; y < 150; ++y) {
+        for (int x = 0; x < 150; ++x) {
+            ASSERT_EQ(l_framebuffer.cell(x, y), l_viewer[std::size_t(y) * 150 + std::size_t(x)]) << x << ", " << y;
+        }
+    }
+}
+
+} // namespace Snake
@@ -0,0 +1,123 @@
+#include "LoadGenerator/LoadGenerator.hpp"
+
+#include <sstream>
+
+#include "SnakeInterface.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace ::testing;
+using namespace std::chrono_literals;
+
+namespace Snake
+{
+
+TEST(ScriptedPolicyTest, test_EverySessionPlaysTheScriptFromItsOwnStep)
+{
+    ScriptedPolicy l_policy("# warm up\nT\n\nD U\nF 3 4\n");
+
+    ASSERT_EQ(3u, l_policy.size());
+    EXPECT_TRUE(l_policy.next(SessionInfo{0, 10, 10, 0}).holds<TimeoutInd>());
+    EXPECT_EQ(Direction_UP, l_policy.next(SessionInfo{1, 10, 10, 1}).get<DirectionInd>().direction);
+    EXPECT_EQ(4, l_policy.next(SessionInfo{0, 10, 10, 2}).get<FoodResp>().y);
+    EXPECT_TRUE(l_policy.next(SessionInfo{1, 10, 10, 3}).holds<TimeoutInd>());
+}
+
+TEST(ScriptedPolicyTest, test_BadLine_ThrowsWithItsNumber)
+{
+    try {
+        ScriptedPolicy l_policy("T\nD X\n");
+        FAIL() << "no ScriptError thrown";
+    } catch (ScriptError const& l_error) {
+        EXPECT_EQ(2u, l_error.line());
+    }
+    EXPECT_THROW(ScriptedPolicy("F 1\n"), ScriptError);
+    EXPECT_THROW(ScriptedPolicy("T 1\n"), ScriptError);
+    EXPECT_THROW(ScriptedPolicy("# nothing\n"), ScriptError);
+}
+
+TEST(SyntheticPolicyTest, test_FoodStaysOnTheMap)
+{
+    SyntheticPolicy l_policy(0.0, 0.0, 1.0);
+
+    for (int i = 0; i < 100; ++i) {
+        FoodResp const l_food = l_policy.next(SessionInfo{0, 3, 2, 0}).get<FoodResp>();
+        EXPECT_TRUE(l_food.x >= 0 and l_food.x < 3 and l_food.y >= 0 and l_food.y < 2);
+    }
+}
+
+struct LoadGeneratorTest : Test
+{
+    LoadGenerator::Clock::time_point time{};
+    ScriptedPolicy ticks{"T"};
+
+    LoadReport run(LoadProfile const& p_profile)
+    {
+        LoadGenerator l_generator(p_profile, ticks, [this] { return time; },
+                                  [this](LoadGenerator::Clock::time_point p_time) { time = p_time; });
+        return l_generator.run();
+    }
+};
+
+TEST_F(LoadGeneratorTest, test_SessionsTakeTurns)
+{
+    LoadProfile l_profile;
+    l_profile.sessions = 2;
+    l_profile.configs = {"W 10 1 F 9 0 S R 1 0 0"};
+    l_profile.maxEvents = 6;
+
+    LoadReport const l_report = run(l_profile);
+
+    EXPECT_EQ(6u, l_report.events);
+    EXPECT_EQ(12u, l_report.displayInds);
+    EXPECT_EQ(0u, l_report.restarts);
+    EXPECT_EQ(6u, l_report.latency.count());
+}
+
+TEST_F(LoadGeneratorTest, test_LostSession_StartsAgain)
+{
+    LoadProfile l_profile;
+    l_profile.configs = {"W 2 1 F 9 9 S R 1 0 0"};
+    l_profile.maxEvents = 4;
+    l_profile.typed = true;
+
+    LoadReport const l_report = run(l_profile);
+
+    EXPECT_EQ(2u, l_report.looseInds);
+    EXPECT_EQ(2u, l_report.restarts);
+    EXPECT_EQ(0u, l_report.errors);
+}
+
+TEST_F(LoadGeneratorTest, test_Rate_SpacesEventsUntilDurationEnds)
+{
+    LoadProfile l_profile;
+    l_profile.sessions = 2;
+    l_profile.configs = {"W 100 1 F 99 0 S R 1 0 0"};
+    l_profile.rate = 50.0;
+    l_profile.duration = 50ms;
+
+    LoadReport const l_report = run(l_profile);
+
+    EXPECT_EQ(5u, l_report.events);
+    EXPECT_DOUBLE_EQ(0.05, l_report.seconds);
+    EXPECT_EQ(0u, l_report.latency.max());
+}
+
+TEST_F(LoadGeneratorTest, test_ProfileWithoutConfigs_Throws)
+{
+    EXPECT_THROW(run(LoadProfile()), std::invalid_argument);
+}
+
+TEST(LoadReportTest, test_WriteReport_OneValuePerLine)
+{
+    LoadReport l_report;
+    l_report.events = 10;
+    l_report.seconds = 2.0;
+
+    std::ostringstream l_out;
+    writeReport(l_out, l_report);
+
+    EXPECT_NE(std::string::npos, l_out.str().find("events_per_second 5\n"));
+}
+
+} // namespace Snake
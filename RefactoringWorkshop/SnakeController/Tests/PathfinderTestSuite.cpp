@@ -0,0 +1,142 @@
+#include "Pathfinder.hpp"
+
+#include <deque>
+#include <random>
+#include <vector>
+
+#include "IPort.hpp"
+#include "SnakeController.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace ::testing;
+
+namespace Snake
+{
+namespace
+{
+
+// Plain queue BFS to compare against.
+std::vector<std::uint32_t> referenceDistances(OccupancyGrid const& p_obstacles, int p_targetX, int p_targetY)
+{
+    int const l_width = p_obstacles.width();
+    std::vector<std::uint32_t> l_distance(std::size_t(l_width) * std::size_t(p_obstacles.height()),
+                                          DistanceField::unreachable);
+    std::deque<std::pair<int, int>> l_queue{{p_targetX, p_targetY}};
+    l_distance[std::size_t(p_targetY * l_width + p_targetX)] = 0;
+
+    while (not l_queue.empty()) {
+        auto const l_cell = l_queue.front();
+        l_queue.pop_front();
+        int const l_moves[4][2] = {{1, 0}, {-1, 0}, {0, 1}, {0, -1}};
+        for (auto const& l_move : l_moves) {
+            int const x = l_cell.first + l_move[0];
+            int const y = l_cell.second + l_move[1];
+            if (p_obstacles.contains(x, y) and not p_obstacles.test(x, y) and
+                l_distance[std::size_t(y * l_width + x)] == DistanceField::unreachable) {
+                l_distance[std::size_t(y * l_width + x)] = l_distance[std::size_t(l_cell.second * l_width + l_cell.first)] + 1;
+                l_queue.emplace_back(x, y);
+            }
+        }
+    }
+    return l_distance;
+}
+
+struct NullPort : IPort
+{
+    void send(std::unique_ptr<Event>) override {}
+};
+
+} // namespace
+
+TEST(DistanceFieldTest, test_MatchesQueueSearchOnRandomMaps)
+{
+    std::minstd_rand l_random(7);
+    int const l_widths[] = {1, 5, 63, 64, 65, 130};
+
+    for (int const l_width : l_widths) {
+        int const l_height = std::uniform_int_distribution<int>(1, 40)(l_random);
+        OccupancyGrid l_obstacles(l_width, l_height);
+        for (int y = 0; y < l_height; ++y) {
+            for (int x = 0; x < l_width; ++x) {
+                if (std::uniform_int_distribution<int>(0, 99)(l_random) < 30) {
+                    l_obstacles.set(x, y);
+                }
+            }
+        }
+        int const l_targetX = std::uniform_int_distribution<int>(0, l_width - 1)(l_random);
+        int const l_targetY = std::uniform_int_distribution<int>(0, l_height - 1)(l_random);
+
+        DistanceField l_field;
+        l_field.compute(l_obstacles, l_targetX, l_targetY);
+
+        auto const l_expected = referenceDistances(l_obstacles, l_targetX, l_targetY);
+        for (int y = 0; y < l_height; ++y) {
+            for (int x = 0; x < l_width; ++x) {
+                ASSERT_EQ(l_expected[std::size_t(y * l_width + x)], l_field.distance(x, y))
+                    << "width " << l_width << " at " << x << ", " << y;
+            }
+        }
+    }
+}
+
+TEST(DistanceFieldTest, test_TargetOutsideMap_LeavesEverythingUnreachable)
+{
+    DistanceField l_field;
+    l_field.compute(OccupancyGrid(4, 4), 4, 0);
+
+    EXPECT_EQ(DistanceField::unreachable, l_field.distance(3, 0));
+    EXPECT_EQ(DistanceField::unreachable, l_field.distance(-1, 0));
+}
+
+TEST(PathfinderTest, test_GoesAroundTheWallTowardsFood)
+{
+    // Food at (2, 0) behind a wall at (2, 1) and (2, 2); head at (2, 3)
+    // moving up: the way round starts with a turn.
+    OccupancyGrid l_board(4, 4);
+    l_board.set(2, 1);
+    l_board.set(2, 2);
+    l_board.set(1, 1);
+    l_board.set(1, 2);
+    l_board.set(2, 3);
+
+    Pathfinder l_pathfinder;
+    EXPECT_EQ(Direction_RIGHT, l_pathfinder.nextDirection(l_board, {2, 3}, Direction_UP, {2, 0}));
+}
+
+TEST(PathfinderTest, test_UnreachableFood_AvoidsTheWall)
+{
+    OccupancyGrid l_board(3, 3);
+    l_board.set(0, 0);
+    l_board.set(0, 1);
+    l_board.set(1, 0);
+
+    Pathfinder l_pathfinder;
+    EXPECT_EQ(Direction_DOWN, l_pathfinder.nextDirection(l_board, {0, 1}, Direction_LEFT, {0, 0}));
+}
+
+TEST(PathfinderTest, test_ChangedBoard_IsSearchedAgain)
+{
+    // Food at (3, 0); (1, 1) is reached through (2, 1) until that is taken.
+    OccupancyGrid l_board(4, 3);
+    l_board.set(0, 1);
+    l_board.set(1, 0);
+    l_board.set(1, 2);
+    Pathfinder l_pathfinder;
+
+    EXPECT_EQ(3u, l_pathfinder.field(l_board, {3, 0}).distance(1, 1));
+
+    l_board.set(2, 1);
+    EXPECT_EQ(DistanceField::unreachable, l_pathfinder.field(l_board, {3, 0}).distance(1, 1));
+}
+
+TEST(PathfinderTest, test_SteersControllerToFood)
+{
+    NullPort l_port;
+    Controller l_controller(l_port, l_port, l_port, "W 10 10 F 3 8 S R 2 3 3 2 3");
+    Pathfinder l_pathfinder;
+
+    EXPECT_EQ(Direction_DOWN, l_pathfinder.nextDirection(l_controller));
+}
+
+} // namespace Snake
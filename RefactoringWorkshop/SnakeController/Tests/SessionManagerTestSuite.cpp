@@ -0,0 +1,115 @@
+#include "SessionManager.hpp"
+
+#include "EventT.hpp"
+#include "IPort.hpp"
+#include "SnakeController.hpp"
+
+#include <gtest/gtest.h>
+
+#include "Mocks/EventMatchers.hpp"
+
+using namespace ::testing;
+
+namespace Snake
+{
+namespace
+{
+
+// Only ever called from the owning session's shard thread; read by the
+// test after SessionManager::waitIdle().
+struct RecordingPort : IPort
+{
+    void send(std::unique_ptr<Event> p_evt) override
+    {
+        events.push_back(std::move(p_evt));
+    }
+
+    std::vector<std::unique_ptr<Event>> events;
+};
+
+struct SessionPorts
+{
+    RecordingPort display;
+    RecordingPort food;
+    RecordingPort score;
+};
+
+} // namespace
+
+struct SessionManagerTest : Test
+{
+    SessionManager sut{3};
+    SessionPorts ports[4];
+
+    SessionManager::SessionId create(std::size_t p_index, std::string const& p_config)
+    {
+        return sut.createSession(ports[p_index].display, ports[p_index].food, ports[p_index].score, p_config);
+    }
+};
+
+TEST_F(SessionManagerTest, test_BadConfig_ThrowsInCallingThread)
+{
+    EXPECT_THROW(create(0, "X 100 100"), ConfigurationError);
+    EXPECT_EQ(0u, sut.sessionCount());
+}
+
+TEST_F(SessionManagerTest, test_BinaryConfig_CreatesSession)
+{
+    std::vector<unsigned char> l_config;
+    encodeBinaryConfig("W 100 100 F 50 50 S R 1 20 20", l_config);
+
+    sut.createSession(ports[0].display, ports[0].food, ports[0].score, BinaryConfig{l_config.data(), l_config.size()});
+    sut.tick();
+    sut.waitIdle();
+
+    ASSERT_EQ(2u, ports[0].display.events.size());
+    EXPECT_THAT(*ports[0].display.events[1], DisplayIndEq(21, 20, Cell_SNAKE));
+}
+
+TEST_F(SessionManagerTest, test_Tick_ReachesEverySession)
+{
+    for (std::size_t i = 0; i < 4; ++i) {
+        create(i, "W 100 100 F 50 50 S R 1 20 " + std::to_string(20 + i));
+    }
+
+    sut.tick();
+    sut.tick();
+    sut.waitIdle();
+
+    for (int i = 0; i < 4; ++i) {
+        ASSERT_EQ(4u, ports[i].display.events.size());
+        EXPECT_THAT(*ports[i].display.events[3], DisplayIndEq(22, 20 + i, Cell_SNAKE));
+    }
+    EXPECT_EQ(8u, sut.stats().ticks);
+}
+
+TEST_F(SessionManagerTest, test_PostedEvents_ReachOnlyTheirSession)
+{
+    auto l_first = create(0, "W 100 100 F 50 50 S R 1 20 20");
+    create(1, "W 100 100 F 50 50 S R 1 20 20");
+
+    sut.post(l_first, std::make_unique<EventT<DirectionInd>>(DirectionInd{Direction_DOWN}));
+    sut.tick();
+    sut.waitIdle();
+
+    EXPECT_THAT(*ports[0].display.events[1], DisplayIndEq(20, 21, Cell_SNAKE));
+    EXPECT_THAT(*ports[1].display.events[1], DisplayIndEq(21, 20, Cell_SNAKE));
+    EXPECT_EQ(1u, sut.stats().events);
+}
+
+TEST_F(SessionManagerTest, test_RejectedEvents_AreCountedAsErrors)
+{
+    auto l_session = create(0, "W 100 100 F 50 50 S R 1 20 20");
+
+    sut.post(l_session, std::make_unique<EventT<ScoreInd>>());
+    sut.waitIdle();
+
+    EXPECT_EQ(1u, sut.stats().errors);
+}
+
+TEST_F(SessionManagerTest, test_PostToUnknownSession_Throws)
+{
+    EXPECT_THROW(sut.post(7, std::make_unique<EventT<TimeoutInd>>()), std::out_of_range);
+}
+
+} // namespace Snake
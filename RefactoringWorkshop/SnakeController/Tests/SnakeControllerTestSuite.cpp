@@ -1,6 +1,8 @@
 #include "SnakeController.hpp"
 
+#include "EventPool.hpp"
 #include "EventT.hpp"
+#include "SnakeWireFormat.hpp"
 
 #include <gtest/gtest.h>
 
@@ -53,6 +55,26 @@ TEST_F(SnakeTest, test_LackOfSnakeDirection_ThrowsException)
     EXPECT_THROW(configureSUT("W 100 100 F 50 50 S X"), ConfigurationError);
 }
 
+TEST_F(SnakeTest, test_EmptyMap_ThrowsException)
+{
+    EXPECT_THROW(configureSUT("W 0 100 F 50 50 S U 1 0 0"), ConfigurationError);
+}
+
+TEST_F(SnakeTest, test_EmptySnake_ThrowsException)
+{
+    EXPECT_THROW(configureSUT("W 100 100 F 50 50 S U 0"), ConfigurationError);
+}
+
+TEST_F(SnakeTest, test_SegmentOutsideMap_ThrowsException)
+{
+    EXPECT_THROW(configureSUT("W 100 100 F 50 50 S U 1 100 20"), ConfigurationError);
+}
+
+TEST_F(SnakeTest, test_OverlappingSegments_ThrowsException)
+{
+    EXPECT_THROW(configureSUT("W 100 100 F 50 50 S U 2 20 20 20 20"), ConfigurationError);
+}
+
 TEST_F(SnakeTest, test_UnexpectedEvent_ThrowsException)
 {
     configureSUT("W 100 100 F 50 50 S U 1 20 20");
@@ -257,6 +279,20 @@ TEST_F(SnakeEatTestSuite, test_IfFoodEncountered_SendFoodRequestAndScoreIndicati
     sut->receive(te.clone());
 }
 
+TEST_F(SnakeEatTestSuite, test_AfterFoodEncountered_SegmentsWithSameTtlAreFreedHeadFirst)
+{
+    EXPECT_CALL(displayPortMock, send_rvr(DisplayIndEq(21, 20, Cell_SNAKE)));
+    EXPECT_CALL(foodPortMock, send_rvr(AnyFoodReq()));
+    EXPECT_CALL(scorePortMock, send_rvr(AnyScoreInd()));
+    sut->receive(te.clone());
+
+    InSequence l_seq;
+    EXPECT_CALL(displayPortMock, send_rvr(DisplayIndEq(21, 20, Cell_FREE)));
+    EXPECT_CALL(displayPortMock, send_rvr(DisplayIndEq(20, 20, Cell_FREE)));
+    EXPECT_CALL(displayPortMock, send_rvr(DisplayIndEq(22, 20, Cell_SNAKE)));
+    sut->receive(te.clone());
+}
+
 TEST_F(SnakeEatTestSuite, test_ReceiveFoodResp_PlaceFoodInCell)
 {
     FoodResp l_foodResp;
@@ -310,4 +346,121 @@ TEST_F(SnakeNewFoodTest, test_ReceiveFoodIndDetectsCollision_ThenRequestNewFood)
     sut->receive(std::make_unique<EventT<FoodInd>>(l_foodInd));
 }
 
+TEST_F(SnakeNewFoodTest, test_ReceiveFoodRespOnCellLeftBySnake_PlaceFoodInCell)
+{
+    EXPECT_CALL(displayPortMock, send_rvr(DisplayIndEq(20, 20, Cell_FREE)));
+    EXPECT_CALL(displayPortMock, send_rvr(DisplayIndEq(21, 20, Cell_SNAKE)));
+    sut->receive(te.clone());
+
+    FoodResp l_foodResp;
+    l_foodResp.x = 20;
+    l_foodResp.y = 20;
+
+    EXPECT_CALL(displayPortMock, send_rvr(DisplayIndEq(20, 20, Cell_FOOD)));
+
+    sut->receive(std::make_unique<EventT<FoodResp>>(l_foodResp));
+}
+
+TEST_F(SnakeNewFoodTest, test_ReceiveFoodIndDecodedFromWire_ClearOldFoodAndPlaceNewOne)
+{
+    std::vector<unsigned char> l_buffer;
+    WireCodec::encode(EventT<FoodInd>(FoodInd{30, 30}), l_buffer);
+
+    EXPECT_CALL(displayPortMock, send_rvr(DisplayIndEq(50, 50, Cell_FREE)));
+    EXPECT_CALL(displayPortMock, send_rvr(DisplayIndEq(30, 30, Cell_FOOD)));
+
+    WireCodec::decode(l_buffer.data(), l_buffer.size(), *sut);
+}
+
+TEST_F(SnakeNewFoodTest, test_ReceiveTypedFoodInd_ClearOldFoodAndPlaceNewOne)
+{
+    EXPECT_CALL(displayPortMock, send_rvr(DisplayIndEq(50, 50, Cell_FREE)));
+    EXPECT_CALL(displayPortMock, send_rvr(DisplayIndEq(30, 30, Cell_FOOD)));
+
+    sut->receive(ControllerInput(FoodInd{30, 30}));
+}
+
+TEST_F(SnakeNewFoodTest, test_TypedTimeoutThroughEventHandlerAdapter_SnakeMoves)
+{
+    EventHandlerAdapter<TimeoutInd, DirectionInd, FoodInd, FoodResp> l_adapter(*sut);
+
+    EXPECT_CALL(displayPortMock, send_rvr(DisplayIndEq(20, 20, Cell_FREE)));
+    EXPECT_CALL(displayPortMock, send_rvr(DisplayIndEq(21, 20, Cell_SNAKE)));
+
+    l_adapter.receive(te.clone());
+}
+
+struct SnakeRelocateFoodTest : SnakeTest
+{
+    void configureSUT(std::string p_config)
+    {
+        SnakeTest::configureSUT(p_config);
+        sut->relocateCollidingFood();
+    }
+};
+
+TEST_F(SnakeRelocateFoodTest, test_ReceiveFoodRespOnSnake_PlaceFoodInFreeCell)
+{
+    configureSUT("W 3 1 F 2 0 S R 2 1 0 0 0");
+
+    EXPECT_CALL(displayPortMock, send_rvr(DisplayIndEq(2, 0, Cell_FOOD)));
+
+    sut->receive(std::make_unique<EventT<FoodResp>>(FoodResp{0, 0}));
+}
+
+TEST_F(SnakeRelocateFoodTest, test_ReceiveFoodIndOnSnake_ClearOldFoodAndPlaceFoodInFreeCell)
+{
+    configureSUT("W 3 1 F 2 0 S R 2 1 0 0 0");
+
+    EXPECT_CALL(displayPortMock, send_rvr(DisplayIndEq(2, 0, Cell_FREE)));
+    EXPECT_CALL(displayPortMock, send_rvr(DisplayIndEq(2, 0, Cell_FOOD)));
+
+    sut->receive(std::make_unique<EventT<FoodInd>>(FoodInd{1, 0}));
+}
+
+TEST_F(SnakeRelocateFoodTest, test_ReceiveFoodRespOnSnakeAfterMove_PlaceFoodInCellLeftBySnake)
+{
+    configureSUT("W 2 1 F 9 9 S R 1 0 0");
+
+    EXPECT_CALL(displayPortMock, send_rvr(DisplayIndEq(0, 0, Cell_FREE)));
+    EXPECT_CALL(displayPortMock, send_rvr(DisplayIndEq(1, 0, Cell_SNAKE)));
+    sut->receive(te.clone());
+
+    EXPECT_CALL(displayPortMock, send_rvr(DisplayIndEq(0, 0, Cell_FOOD)));
+
+    sut->receive(std::make_unique<EventT<FoodResp>>(FoodResp{1, 0}));
+}
+
+TEST_F(SnakeRelocateFoodTest, test_ReceiveFoodRespOnFullMap_ThenRequestNewFood)
+{
+    configureSUT("W 2 1 F 9 9 S R 2 1 0 0 0");
+
+    EXPECT_CALL(foodPortMock, send_rvr(AnyFoodReq()));
+
+    sut->receive(std::make_unique<EventT<FoodResp>>(FoodResp{0, 0}));
+}
+
+struct SnakeEventPoolTest : SnakeTest
+{
+    void SetUp() override
+    {
+        configureSUT("W 1000 1 F 999 0 S R 3 2 0 1 0 0 0");
+    }
+};
+
+TEST_F(SnakeEventPoolTest, test_SteadyStateTicks_DoNotAllocateEventsFromHeap)
+{
+    EXPECT_CALL(displayPortMock, send_rvr(_)).Times(AnyNumber());
+
+    sut->receive(te.clone());
+    resetEventPoolStats();
+
+    for (int i = 0; i < 100; ++i) {
+        sut->receive(te.clone());
+    }
+
+    EXPECT_EQ(0u, eventPoolStats().heapAllocations);
+    EXPECT_EQ(300u, eventPoolStats().reuses);
+}
+
 } // namespace Snake